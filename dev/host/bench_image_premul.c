@@ -0,0 +1,159 @@
+/**
+ * \file            bench_image_premul.c
+ * \brief           Draw time of 32-bit image with straight and premultiplied alpha
+ *
+ *                  Round 64x64 icon with anti-aliased edge and transparent corners is drawn
+ *                  with software driver to ARGB8888 layer, with straight alpha, with \ref GUI_IMAGE_FLAG_PREMULTIPLIED
+ *                  and with premultiplied alpha and \ref gui_image_desc_t.rows table.
+ *                  Premultiplied image may differ from straight one only by rounding of each channel,
+ *                  rows table must not change any pixel.
+ *
+ *                  Benchmark is built with SIMD kernels and with scalar kernels only.
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_draw.h"
+#include "system/gui_ll_soft.h"
+#include "host.h"
+#include "math.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define ICON_SIZE           64
+#define ITERATIONS          20000
+
+static uint8_t straight_data[ICON_SIZE * ICON_SIZE * 4];
+static uint8_t premul_data[ICON_SIZE * ICON_SIZE * 4];
+static gui_image_row_t rows[ICON_SIZE];
+static uint32_t background[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+static uint32_t ref[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+
+/**
+ * \brief           Create round icon with straight and premultiplied alpha and table of visible parts
+ */
+static void
+create_icon(void) {
+    uint8_t* s = straight_data;
+    uint8_t* p = premul_data;
+    double d;
+    int x, y, i, a;
+
+    for (y = 0; y < ICON_SIZE; y++) {
+        rows[y].x1 = rows[y].x2 = 0;
+        for (x = 0; x < ICON_SIZE; x++, s += 4, p += 4) {
+            d = sqrt((x - 31.5) * (x - 31.5) + (y - 31.5) * (y - 31.5));
+            a = (int)((28.0 - d) * 255.0);          /* Edge of circle is 1 pixel wide */
+            a = a < 0 ? 0 : a > 255 ? 255 : a;
+            s[0] = 40 + 3 * x;
+            s[1] = 200 - 2 * y;
+            s[2] = 90 + x + y;
+            s[3] = 255 - a;                         /* Alpha is inverted in image */
+            for (i = 0; i < 3; i++) {
+                p[i] = (s[i] * a + 127) / 255;
+            }
+            p[3] = s[3];
+            if (a) {
+                if (rows[y].x1 == rows[y].x2) {
+                    rows[y].x1 = x;
+                }
+                rows[y].x2 = x + 1;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Draw image over background
+ * \param[in]       frame: Frame buffer of drawing layer
+ * \param[in]       disp: Clipping region
+ * \param[in]       img: Image to draw
+ */
+static void
+draw(uint32_t* frame, gui_display_t* disp, const gui_image_desc_t* img) {
+    memcpy(frame, background, sizeof(background));
+    gui_draw_image(disp, 10, 10, img);
+    guii_draw_flush();
+}
+
+/**
+ * \brief           Measure average draw time of image
+ * \param[in]       disp: Clipping region
+ * \param[in]       img: Image to draw
+ * \return          Average time in units of nanoseconds
+ */
+static uint64_t
+measure(gui_display_t* disp, const gui_image_desc_t* img) {
+    uint64_t t;
+    size_t i;
+
+    t = host_now_ns();
+    for (i = 0; i < ITERATIONS; i++) {
+        gui_draw_image(disp, 10, 10, img);
+    }
+    guii_draw_flush();
+    return (host_now_ns() - t) / ITERATIONS;
+}
+
+int
+main(void) {
+    gui_image_desc_t straight = {0}, premul, premul_rows;
+    gui_display_t disp = {0, 0, HOST_LCD_WIDTH, HOST_LCD_HEIGHT};
+    uint32_t* frame;
+    size_t i, k, diff, max_diff = 0, errors = 0;
+    uint64_t t_straight, t_premul, t_rows;
+
+    if (gui_init() != guiOK) {
+        printf("gui_init failed\n");
+        return 1;
+    }
+    frame = (uint32_t *)GUI.lcd.drawing_layer->start_address;
+
+    create_icon();
+    straight.x_size = ICON_SIZE;
+    straight.y_size = ICON_SIZE;
+    straight.bpp = 32;
+    straight.image = straight_data;
+    premul = straight;
+    premul.image = premul_data;
+    premul.flags = GUI_IMAGE_FLAG_PREMULTIPLIED;
+    premul_rows = premul;
+    premul_rows.rows = rows;
+
+    /* Compare premultiplied images against straight image on random background */
+    srand(2);
+    for (i = 0; i < GUI_COUNT_OF(background); i++) {
+        background[i] = 0xFF000000UL | (rand() & 0xFFFFFF);
+    }
+    draw(frame, &disp, &straight);
+    memcpy(ref, frame, sizeof(ref));
+    draw(frame, &disp, &premul);
+    for (i = 0; i < GUI_COUNT_OF(ref); i++) {
+        for (k = 0; k < 32; k += 8) {
+            diff = abs((int)((ref[i] >> k) & 0xFF) - (int)((frame[i] >> k) & 0xFF));
+            max_diff = GUI_MAX(max_diff, diff);
+        }
+    }
+    memcpy(ref, frame, sizeof(ref));
+    draw(frame, &disp, &premul_rows);
+    if (memcmp(ref, frame, sizeof(ref))) {
+        printf("rows table changed pixels\n");
+        errors++;
+    }
+    if (max_diff > 1) {
+        printf("premultiplied image differs from straight by %u\n", (unsigned)max_diff);
+        errors++;
+    }
+
+    t_straight = measure(&disp, &straight);
+    t_premul = measure(&disp, &premul);
+    t_rows = measure(&disp, &premul_rows);
+
+    printf("%ux%u round icon, %s kernels, ARGB8888 layer\n", ICON_SIZE, ICON_SIZE, gui_ll_soft_getkernelname());
+    printf("%24s %10s\n", "", "ns");
+    printf("%24s %10u\n", "straight", (unsigned)t_straight);
+    printf("%24s %10u\n", "premultiplied", (unsigned)t_premul);
+    printf("%24s %10u\n", "premultiplied with rows", (unsigned)t_rows);
+    printf("max channel difference %u, errors %u\n", (unsigned)max_diff, (unsigned)errors);
+    return errors != 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * \file            bench_image_rle.c
+ * \brief           Flash size and draw time of run-length encoded image
+ *
+ *                  Image `dev/src/image_brand.c` from emWin Bitmap Converter is encoded with \ref image_rle_encode
+ *                  and drawn with software driver, uncompressed and encoded, fully visible and half clipped.
+ *                  Encoded image must draw the same pixels as uncompressed one for random clipping regions.
+ *                  Encoded image with 4 bits per pixel must not be drawn at all.
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_draw.h"
+#include "emwin/GUI.h"
+#include "image_rle.h"
+#include "host.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define ITERATIONS          20000
+#define CHECKS              2000
+
+extern GUI_CONST_STORAGE GUI_BITMAP bmimage_brand;
+
+static uint32_t ref[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+static gui_color_t palette[256];                    /* Opaque colors for any index */
+
+/**
+ * \brief           Fill frame with pattern, so not drawn pixels are detected
+ */
+static void
+clear_frame(uint32_t* frame) {
+    size_t i;
+
+    for (i = 0; i < HOST_LCD_WIDTH * HOST_LCD_HEIGHT; i++) {
+        frame[i] = 0xFF000000UL | (i * 0x10101UL);
+    }
+}
+
+/**
+ * \brief           Measure average draw time of image
+ * \param[in]       disp: Clipping region
+ * \param[in]       img: Image to draw
+ * \return          Average time in units of nanoseconds
+ */
+static uint64_t
+measure(gui_display_t* disp, const gui_image_desc_t* img) {
+    uint64_t t;
+    size_t i;
+
+    t = host_now_ns();
+    for (i = 0; i < ITERATIONS; i++) {
+        gui_draw_image(disp, 10, 10, img);
+    }
+    return (host_now_ns() - t) / ITERATIONS;
+}
+
+int
+main(void) {
+    gui_image_desc_t raw = {0}, rle;
+    gui_display_t disp;
+    uint32_t* frame;
+    uint8_t* data;
+    size_t i, raw_size, rle_size, drawn = 0, errors = 0;
+    uint64_t raw_full, rle_full, raw_half, rle_half;
+
+    if (gui_init() != guiOK) {
+        printf("gui_init failed\n");
+        return 1;
+    }
+    frame = (uint32_t *)GUI.lcd.drawing_layer->start_address;  /* Image is drawn to current drawing layer */
+
+    raw.x_size = bmimage_brand.XSize;
+    raw.y_size = bmimage_brand.YSize;
+    raw.bpp = bmimage_brand.BitsPerPixel;
+    raw.image = bmimage_brand.pData;
+    raw_size = (size_t)bmimage_brand.BytesPerLine * bmimage_brand.YSize;
+
+    rle_size = image_rle_encode(raw.image, raw.x_size, raw.y_size, raw.bpp, NULL);
+    data = malloc(rle_size);
+    image_rle_encode(raw.image, raw.x_size, raw.y_size, raw.bpp, data);
+    rle = raw;
+    rle.image = data;
+    rle.flags = GUI_IMAGE_FLAG_RLE;
+
+    /* Compare encoded image against uncompressed for random clipping and position */
+    srand(1);
+    for (i = 0; i < CHECKS; i++) {
+        gui_dim_t x = rand() % 200 - 50, y = rand() % 200 - 50;
+
+        disp.x1 = rand() % 150;
+        disp.y1 = rand() % 150;
+        disp.x2 = disp.x1 + 1 + rand() % 150;
+        disp.y2 = disp.y1 + 1 + rand() % 150;
+        clear_frame(frame);
+        gui_draw_image(&disp, x, y, &raw);
+        memcpy(ref, frame, sizeof(ref));
+        clear_frame(frame);
+        drawn += memcmp(ref, frame, sizeof(ref)) != 0;  /* Check image is visible in reference */
+        clear_frame(frame);
+        gui_draw_image(&disp, x, y, &rle);
+        if (memcmp(ref, frame, sizeof(ref))) {
+            errors++;
+        }
+    }
+
+    disp.x1 = 0;
+    disp.y1 = 0;
+    disp.x2 = HOST_LCD_WIDTH;
+    disp.y2 = HOST_LCD_HEIGHT;
+
+    /* Encoded image with less than 8 bits per pixel must not be drawn */
+    clear_frame(ref);
+    clear_frame(frame);
+    for (i = 0; i < GUI_COUNT_OF(palette); i++) {
+        palette[i] = 0xFF000000UL | (i * 0x10101UL);
+    }
+    rle.bpp = 4;
+    rle.palette = palette;
+    rle.palette_size = GUI_COUNT_OF(palette);
+    gui_draw_image(&disp, 10, 10, &rle);
+    rle.bpp = raw.bpp;
+    rle.palette = NULL;
+    rle.palette_size = 0;
+    if (memcmp(ref, frame, sizeof(ref))) {
+        printf("encoded L4 image was drawn\n");
+        errors++;
+    }
+
+    raw_full = measure(&disp, &raw);
+    rle_full = measure(&disp, &rle);
+    disp.y2 = 10 + raw.y_size / 2;                  /* Bottom half of image is clipped */
+    raw_half = measure(&disp, &raw);
+    rle_half = measure(&disp, &rle);
+
+    printf("image_brand %ux%u %ubpp\n", (unsigned)raw.x_size, (unsigned)raw.y_size, (unsigned)raw.bpp);
+    printf("%12s %10s %10s %14s\n", "", "flash B", "full ns", "half clip ns");
+    printf("%12s %10u %10u %14u\n", "raw", (unsigned)raw_size, (unsigned)raw_full, (unsigned)raw_half);
+    printf("%12s %10u %10u %14u\n", "rle", (unsigned)rle_size, (unsigned)rle_full, (unsigned)rle_half);
+    printf("random clip checks %u, visible %u, errors %u\n", (unsigned)CHECKS, (unsigned)drawn, (unsigned)errors);
+    free(data);
+    return errors != 0 || drawn == 0;
+}
@@ -0,0 +1,79 @@
+/**	
+ * \file            bench_invalidate.c
+ * \brief           Cost of widget invalidation against number of sibling widgets
+ *
+ *                  Invalidating widget checks all siblings above it against list of redrawn regions.
+ *                  Benchmark creates container with N buttons in a grid and measures
+ *                  invalidation of bottom-most child (all siblings are checked),
+ *                  top-most child (no sibling is checked) and container itself,
+ *                  next to time needed to redraw the same widget.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "widget/gui_widget.h"
+#include "widget/gui_window.h"
+#include "widget/gui_container.h"
+#include "widget/gui_button.h"
+#include "host.h"
+#include "stdio.h"
+
+#define ITERATIONS          500
+
+/**
+ * \brief           Measure average invalidation and redraw time of widget
+ * \param[in]       h: Widget to invalidate
+ * \param[out]      redraw: Average redraw time in units of nanoseconds
+ * \return          Average invalidation time in units of nanoseconds
+ */
+static uint64_t
+measure(gui_handle_p h, uint64_t* redraw) {
+    uint64_t inv = 0, draw = 0, t;
+    size_t i;
+    
+    for (i = 0; i < ITERATIONS; i++) {
+        t = host_now_ns();
+        gui_widget_invalidate(h);
+        inv += host_now_ns() - t;
+        
+        t = host_now_ns();
+        gui_process();                              /* Redraw and clear redraw flags for next iteration */
+        draw += host_now_ns() - t;
+    }
+    *redraw = draw / ITERATIONS;
+    return inv / ITERATIONS;
+}
+
+int
+main(void) {
+    static const size_t counts[] = {8, 16, 32, 64, 128, 256, 512};
+    size_t c, i;
+    
+    gui_init();
+    
+    printf("%8s | %10s %10s | %10s %10s | %10s %10s\n", "children", "bottom ns", "redraw ns", "top ns", "redraw ns", "parent ns", "redraw ns");
+    for (c = 0; c < GUI_COUNT_OF(counts); c++) {
+        gui_handle_p cont, first = NULL, last = NULL;
+        uint64_t bottom, top, parent, bottom_draw, top_draw, parent_draw;
+        size_t cols = 32, rows = (counts[c] + cols - 1) / cols;
+        gui_dim_t w = HOST_LCD_WIDTH / cols, h = HOST_LCD_HEIGHT / (rows > 8 ? rows : 8);
+        
+        cont = gui_container_create(0, 0, 0, HOST_LCD_WIDTH, HOST_LCD_HEIGHT, gui_window_getdesktop(), NULL, 0);
+        for (i = 0; i < counts[c]; i++) {
+            last = gui_button_create(0, (i % cols) * w, (i / cols) * h, w, h, cont, NULL, 0);
+            if (first == NULL) {
+                first = last;
+            }
+        }
+        gui_process();                              /* Draw everything first time */
+        
+        bottom = measure(first, &bottom_draw);
+        top = measure(last, &top_draw);
+        parent = measure(cont, &parent_draw);
+        printf("%8u | %10u %10u | %10u %10u | %10u %10u\n", (unsigned)counts[c],
+            (unsigned)bottom, (unsigned)bottom_draw, (unsigned)top, (unsigned)top_draw, (unsigned)parent, (unsigned)parent_draw);
+        
+        gui_widget_remove(&cont);
+        gui_process();                              /* Execute remove */
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+/**
+ * \file            bench_mem.c
+ * \brief           Allocation and free time of memory manager under widget-like churn
+ *
+ *                  Built twice, with first-fit (`GUI_CFG_MEM_TLSF=0`) and TLSF (`GUI_CFG_MEM_TLSF=1`) allocator.
+ *                  Heap is split to 2 regions. First phase opens and closes bursts of widget sized objects,
+ *                  second phase keeps many small long-lived objects with holes between them
+ *                  and allocates widget sized objects against fragmented heap.
+ *
+ *                  Content of each block is checked before it is freed.
+ *                  Times are in units of nanoseconds with timer overhead subtracted.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "gui/gui_mem.h"
+#include "host.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define OPERATIONS          2000000
+#define FRAG_OPERATIONS     200000
+#define MAX_LIVE            4000
+#define KEEP_COUNT          9000
+#define HIST_SIZE           100000
+
+static uint8_t heap1[96 * 1024 + 3];                /* Unaligned region */
+static uint8_t heap2[160 * 1024];
+
+/**
+ * \brief           Live allocated block
+ */
+typedef struct {
+    uint8_t* ptr;                                   /*!< Allocated memory */
+    size_t size;                                    /*!< Requested size */
+    uint8_t tag;                                    /*!< Value written to all bytes */
+} block_t;
+
+/**
+ * \brief           Time statistics of single function
+ */
+typedef struct {
+    uint32_t hist[HIST_SIZE];                       /*!< Number of calls per time in nanoseconds */
+    uint64_t sum;                                   /*!< Sum of all times */
+    uint64_t max;                                   /*!< Maximal time */
+    uint64_t count;                                 /*!< Number of calls */
+} stat_t;
+
+static block_t live[MAX_LIVE];
+static size_t live_count;
+static stat_t alloc_stat, free_stat;
+static uint64_t overhead;                           /* Time of empty measurement */
+static size_t fails, bad;
+
+/**
+ * \brief           Add time to statistics
+ */
+static void
+stat_add(stat_t* s, uint64_t t) {
+    t = t > overhead ? t - overhead : 0;
+    s->hist[t < HIST_SIZE ? t : HIST_SIZE - 1]++;
+    s->sum += t;
+    s->count++;
+    if (t > s->max) {
+        s->max = t;
+    }
+}
+
+/**
+ * \brief           Get time below which is given part of calls
+ */
+static uint64_t
+stat_percentile(const stat_t* s, double part) {
+    uint64_t c = 0;
+    size_t i;
+
+    for (i = 0; i < HIST_SIZE; i++) {
+        c += s->hist[i];
+        if (c >= s->count * part) {
+            return i;
+        }
+    }
+    return HIST_SIZE - 1;
+}
+
+static void
+stat_print(const char* name, const stat_t* s) {
+    printf("%-10s avg %5u p99 %5u p99.99 %6u max %7u ns\n", name, (unsigned)(s->sum / s->count),
+        (unsigned)stat_percentile(s, 0.99), (unsigned)stat_percentile(s, 0.9999), (unsigned)s->max);
+}
+
+static void*
+timed_alloc(size_t size) {
+    uint64_t t = host_now_ns();
+    void* ptr = gui_mem_alloc(size);
+    stat_add(&alloc_stat, host_now_ns() - t);
+    return ptr;
+}
+
+static void
+timed_free(void* ptr) {
+    uint64_t t = host_now_ns();
+    gui_mem_free(ptr);
+    stat_add(&free_stat, host_now_ns() - t);
+}
+
+/**
+ * \brief           Get random size of widget related object
+ */
+static size_t
+widget_size(void) {
+    int r = rand() % 100;
+    if (r < 50) {
+        return 8 + rand() % 56;                     /* Texts, list items, timers */
+    } else if (r < 85) {
+        return 100 + rand() % 250;                  /* Widget handles */
+    } else if (r < 97) {
+        return 400 + rand() % 800;                  /* Larger widgets and buffers */
+    }
+    return 1024 + rand() % 6000;                    /* Image and text buffers */
+}
+
+/**
+ * \brief           Check content and free live block
+ */
+static void
+live_free(size_t i) {
+    size_t k;
+
+    for (k = 0; k < live[i].size; k++) {
+        if (live[i].ptr[k] != live[i].tag) {
+            bad++;
+            break;
+        }
+    }
+    timed_free(live[i].ptr);
+    live[i] = live[--live_count];
+}
+
+int
+main(void) {
+    static void* keep[KEEP_COUNT];
+    GUI_MEM_Region_t regions[] = {
+        {heap1 + 3, sizeof(heap1) - 3},
+        {heap2, sizeof(heap2)},
+    };
+    size_t total, i, minfree;
+    uint64_t t;
+    long op;
+
+    if (&heap2[0] < &heap1[0]) {                    /* Regions must be in rising address order */
+        regions[0].StartAddress = heap2;
+        regions[0].Size = sizeof(heap2);
+        regions[1].StartAddress = heap1 + 3;
+        regions[1].Size = sizeof(heap1) - 3;
+    }
+    if (!gui_mem_assignmemory(regions, GUI_COUNT_OF(regions))) {
+        printf("Cannot assign memory\n");
+        return 1;
+    }
+    for (i = 0, overhead = ~0ULL; i < 1000; i++) {  /* Timer overhead */
+        t = host_now_ns();
+        t = host_now_ns() - t;
+        if (t < overhead) {
+            overhead = t;
+        }
+    }
+    total = gui_mem_getfree();
+    srand(7);
+
+    /* Widget churn: burst of new widgets, then remove random widgets */
+    for (op = 0; op < OPERATIONS; ) {
+        int burst = 5 + rand() % 40, remove;
+
+        for (i = 0; i < burst && live_count < MAX_LIVE; i++, op++) {
+            block_t* b = &live[live_count];
+            b->size = widget_size();
+            if ((b->ptr = timed_alloc(b->size)) == NULL) {
+                fails++;
+                continue;
+            }
+            b->tag = rand();
+            memset(b->ptr, b->tag, b->size);
+            live_count++;
+        }
+        remove = rand() % (live_count + 1);
+        if (live_count > MAX_LIVE / 2 || gui_mem_getfree() < total / 4) {
+            remove = live_count * 3 / 4;
+        }
+        for (i = 0; i < remove && live_count; i++, op++) {
+            live_free(rand() % 3 == 0 ? live_count - 1 : rand() % live_count);
+        }
+    }
+    minfree = gui_mem_getminfree();
+    printf("widget churn: %u calls, %u failed allocations, min free %u/%u bytes\n",
+        (unsigned)(alloc_stat.count + free_stat.count), (unsigned)fails, (unsigned)minfree, (unsigned)total);
+    stat_print("  alloc", &alloc_stat);
+    stat_print("  free", &free_stat);
+
+    /* Fragmented heap: long-lived small objects with holes between them */
+    for (i = 0; i < KEEP_COUNT; i++) {
+        keep[i] = gui_mem_alloc(16 + rand() % 32);
+    }
+    for (i = 0; i < KEEP_COUNT; i += 2) {
+        gui_mem_free(keep[i]);
+    }
+    memset(&alloc_stat, 0, sizeof(alloc_stat));
+    memset(&free_stat, 0, sizeof(free_stat));
+    for (op = 0; op < FRAG_OPERATIONS; op += 2) {
+        void* p = timed_alloc(200 + rand() % 300);
+        void* q = timed_alloc(64 + rand() % 64);
+        if (p == NULL || q == NULL) {
+            fails++;
+        }
+        timed_free(p);
+        timed_free(q);
+    }
+    printf("fragmented heap: %u calls\n", (unsigned)(alloc_stat.count + free_stat.count));
+    stat_print("  alloc", &alloc_stat);
+    stat_print("  free", &free_stat);
+    for (i = 1; i < KEEP_COUNT; i += 2) {
+        gui_mem_free(keep[i]);
+    }
+
+    while (live_count) {
+        live_free(live_count - 1);
+    }
+    printf("after free: free %u/%u bytes, used %u bytes, corrupted blocks %u\n",
+        (unsigned)gui_mem_getfree(), (unsigned)total, (unsigned)gui_mem_getfull(), (unsigned)bad);
+    return bad || gui_mem_getfree() != total;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file            cmsis_os.h
+ * \brief           Minimal CMSIS-OS types for host builds
+ *
+ *                  Host build is single threaded, types are only needed by system port header
+ */
+#ifndef __CMSIS_OS_H
+#define __CMSIS_OS_H
+
+#include "stdint.h"
+
+typedef void*   osMutexId;
+typedef void*   osSemaphoreId;
+typedef void*   osMessageQId;
+typedef void*   osThreadId;
+
+typedef enum {
+    osPriorityNormal = 0,
+} osPriority;
+
+#define osWaitForever       0xFFFFFFFF
+
+#endif /* __CMSIS_OS_H */
@@ -0,0 +1,269 @@
+/**	
+ * \file            dma2d_model.c
+ * \brief           Host model of DMA2D peripheral and its interrupt
+ *
+ *                  Transfer thread executes operation when `START` bit is set in `CR` register,
+ *                  sets transfer complete flag and calls \ref DMA2D_IRQHandler when interrupt is enabled.
+ *                  CLUT thread loads foreground CLUT when `START` bit is set in `FGPFCCR` register,
+ *                  in parallel to transfer thread as CLUT loading is separate DMA on hardware.
+ *                  Transfer started before CLUT loading is finished is counted as error.
+ *
+ *                  Interrupt is not called between \ref HAL_NVIC_DisableIRQ and \ref HAL_NVIC_EnableIRQ,
+ *                  flags written to `IFCR` by interrupt handler clear flags in `ISR` after handler returns.
+ */
+#include "lcd_discovery.h"
+#include "pthread.h"
+#include "string.h"
+#include "time.h"
+
+DMA2D_TypeDef dma2d_regs;
+uint32_t dma2d_model_frame[GUI_LAYERS][LCD_WIDTH * LCD_HEIGHT];
+
+static pthread_mutex_t irq_mutex = PTHREAD_MUTEX_INITIALIZER;   /* Locked when interrupt is disabled or running */
+static uint8_t irq_disabled;                    /* Set when interrupt is disabled by driver */
+static pthread_t transfer_thread, clut_thread;
+static volatile uint8_t running;
+static uint32_t op_delay_ns;                    /* Time each transfer takes */
+static uint32_t clut[256];                      /* Foreground CLUT memory */
+static volatile size_t op_count, clut_count, error_count;
+
+#define PTR(addr)                   ((void *)(uintptr_t)(addr))
+
+void
+HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t prio, uint32_t subprio) {
+
+}
+
+void
+HAL_NVIC_DisableIRQ(IRQn_Type irq) {
+    pthread_mutex_lock(&irq_mutex);
+    irq_disabled = 1;
+}
+
+void
+HAL_NVIC_EnableIRQ(IRQn_Type irq) {
+    if (irq_disabled) {
+        irq_disabled = 0;
+        pthread_mutex_unlock(&irq_mutex);
+    }
+}
+
+void
+TM_SDRAM_Init(void) {
+
+}
+
+void
+_LCD_Init(void) {
+
+}
+
+/**
+ * \brief           Get ARGB8888 color of input pixel
+ * \param[in]       pfccr: Value of PFC control register
+ * \param[in]       colr: Value of color register for A8 and A4 inputs
+ * \param[in]       line: Pointer to start of line
+ * \param[in]       x: Pixel index in line
+ * \return          Pixel color
+ */
+static uint32_t
+get_pixel(uint32_t pfccr, uint32_t colr, const uint8_t* line, uint32_t x) {
+    uint32_t c, a, alpha = pfccr >> DMA2D_FGPFCCR_ALPHA_Pos;
+    
+    switch (pfccr & DMA2D_FGPFCCR_CM) {
+        case DMA2D_INPUT_ARGB8888: memcpy(&c, &line[4 * x], 4); break;
+        case DMA2D_INPUT_RGB888: c = 0xFF000000UL | line[3 * x + 2] << 16 | line[3 * x + 1] << 8 | line[3 * x]; break;
+        case DMA2D_INPUT_RGB565: {
+            uint32_t v = line[2 * x] | line[2 * x + 1] << 8;
+            c = 0xFF000000UL | ((v >> 8) & 0xF8) << 16 | ((v >> 3) & 0xFC) << 8 | ((v << 3) & 0xF8);
+            break;
+        }
+        case DMA2D_INPUT_L8: c = clut[line[x]]; break;
+        case DMA2D_INPUT_L4: c = clut[(x & 1) ? (line[x >> 1] >> 4) : (line[x >> 1] & 0x0F)]; break;
+        case DMA2D_INPUT_A8: c = (colr & 0x00FFFFFFUL) | (uint32_t)line[x] << 24; break;
+        case DMA2D_INPUT_A4: c = (colr & 0x00FFFFFFUL) | (uint32_t)(((x & 1) ? (line[x >> 1] >> 4) : (line[x >> 1] & 0x0F)) * 0x11) << 24; break;
+        default: c = 0; break;
+    }
+    if (pfccr & DMA2D_FGPFCCR_RBS) {                /* Swap red and blue */
+        c = (c & 0xFF00FF00UL) | (c >> 16 & 0xFF) | (c & 0xFF) << 16;
+    }
+    a = c >> 24;
+    if (pfccr & DMA2D_FGPFCCR_AI) {
+        a = 255 - a;
+    }
+    switch ((pfccr >> DMA2D_FGPFCCR_AM_Pos) & 0x03) {
+        case 1: a = alpha; break;                   /* Replace alpha */
+        case 2: a = a * alpha / 255; break;         /* Multiply alpha */
+        default: break;
+    }
+    return (c & 0x00FFFFFFUL) | a << 24;
+}
+
+/**
+ * \brief           Get size of input line in units of bytes
+ */
+static size_t
+get_line_size(uint32_t pfccr, uint32_t pixels) {
+    switch (pfccr & DMA2D_FGPFCCR_CM) {
+        case DMA2D_INPUT_ARGB8888: return 4 * pixels;
+        case DMA2D_INPUT_RGB888: return 3 * pixels;
+        case DMA2D_INPUT_RGB565: return 2 * pixels;
+        case DMA2D_INPUT_L4: case DMA2D_INPUT_A4: return pixels / 2;
+        default: return pixels;
+    }
+}
+
+/**
+ * \brief           Blend foreground over background with DMA2D formula
+ */
+static uint32_t
+blend(uint32_t fg, uint32_t bg) {
+    uint32_t af = fg >> 24, ab = bg >> 24, am = af * ab / 255, ao = af + ab - am, c = ao << 24, i;
+    
+    if (!ao) {
+        return 0;
+    }
+    for (i = 0; i < 24; i += 8) {
+        c |= (((fg >> i) & 0xFF) * af + ((bg >> i) & 0xFF) * (ab - am)) / ao << i;
+    }
+    return c;
+}
+
+/**
+ * \brief           Execute operation programmed to registers
+ */
+static void
+execute(void) {
+    uint32_t w = DMA2D->NLR >> 16, h = DMA2D->NLR & 0xFFFF, x, y, mode = DMA2D->CR & DMA2D_CR_MODE;
+    const uint8_t* fg = PTR(DMA2D->FGMAR);
+    const uint8_t* bg = PTR(DMA2D->BGMAR);
+    uint32_t* out = PTR(DMA2D->OMAR);
+    uint32_t c;
+    
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            if (mode == DMA2D_R2M) {
+                c = DMA2D->OCOLR;
+            } else if (mode == DMA2D_M2M) {
+                memcpy(&c, &fg[4 * x], 4);          /* No conversion, output format is used */
+            } else {
+                c = get_pixel(DMA2D->FGPFCCR, DMA2D->FGCOLR, fg, x);
+                if (mode == DMA2D_M2M_BLEND) {
+                    c = blend(c, get_pixel(DMA2D->BGPFCCR, DMA2D->BGCOLR, bg, x));
+                }
+            }
+            out[x] = c;
+        }
+        out += w + DMA2D->OOR;
+        if (mode == DMA2D_M2M) {
+            fg += 4 * (w + DMA2D->FGOR);
+        } else {
+            fg += get_line_size(DMA2D->FGPFCCR, w + DMA2D->FGOR);
+        }
+        bg += get_line_size(DMA2D->BGPFCCR, w + DMA2D->BGOR);
+    }
+}
+
+static void
+wait_ns(uint32_t ns) {
+    struct timespec ts = {0, (long)ns};
+    if (ns) {
+        nanosleep(&ts, NULL);
+    }
+}
+
+/**
+ * \brief           Call interrupt handler when enabled interrupt flag is set
+ */
+static void
+process_irq(void) {
+    uint32_t en = ((DMA2D->CR & DMA2D_CR_TCIE) ? DMA2D_ISR_TCIF : 0)
+                | ((DMA2D->CR & DMA2D_CR_TEIE) ? DMA2D_ISR_TEIF : 0)
+                | ((DMA2D->CR & DMA2D_CR_CTCIE) ? DMA2D_ISR_CTCIF : 0);
+    
+    if (DMA2D->ISR & en) {
+        pthread_mutex_lock(&irq_mutex);             /* Wait while interrupt is disabled */
+        DMA2D->IFCR = 0;
+        DMA2D_IRQHandler();
+        __atomic_fetch_and(&DMA2D->ISR, ~DMA2D->IFCR, __ATOMIC_SEQ_CST);  /* Handler cleared flags */
+        pthread_mutex_unlock(&irq_mutex);
+    }
+}
+
+static void*
+transfer_thread_fn(void* arg) {
+    while (running) {
+        if (DMA2D->CR & DMA2D_CR_START) {
+            if (DMA2D->FGPFCCR & DMA2D_FGPFCCR_START) { /* Driver must wait for CLUT transfer complete */
+                error_count++;
+            }
+            wait_ns(op_delay_ns);                   /* Transfer takes some time */
+            execute();
+            op_count++;
+            DMA2D->CR &= ~DMA2D_CR_START;
+            __atomic_fetch_or(&DMA2D->ISR, DMA2D_ISR_TCIF, __ATOMIC_SEQ_CST);
+        }
+        process_irq();
+    }
+    return NULL;
+}
+
+static void*
+clut_thread_fn(void* arg) {
+    while (running) {
+        if (DMA2D->FGPFCCR & DMA2D_FGPFCCR_START) {
+            wait_ns(op_delay_ns);                   /* CLUT loading takes some time */
+            memcpy(clut, PTR(DMA2D->FGCMAR), 4 * (((DMA2D->FGPFCCR & DMA2D_FGPFCCR_CS) >> DMA2D_FGPFCCR_CS_Pos) + 1));
+            clut_count++;
+            DMA2D->FGPFCCR &= ~DMA2D_FGPFCCR_START;
+            __atomic_fetch_or(&DMA2D->ISR, DMA2D_ISR_CTCIF, __ATOMIC_SEQ_CST);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Start model of DMA2D
+ * \param[in]       delay_ns: Time each transfer takes, use to let queue fill up
+ */
+void
+dma2d_model_start(uint32_t delay_ns) {
+    op_delay_ns = delay_ns;
+    running = 1;
+    pthread_create(&transfer_thread, NULL, transfer_thread_fn, NULL);
+    pthread_create(&clut_thread, NULL, clut_thread_fn, NULL);
+}
+
+/**
+ * \brief           Stop model of DMA2D
+ */
+void
+dma2d_model_stop(void) {
+    running = 0;
+    pthread_join(transfer_thread, NULL);
+    pthread_join(clut_thread, NULL);
+}
+
+/**
+ * \brief           Get number of executed transfers
+ */
+size_t
+dma2d_model_getopcount(void) {
+    return op_count;
+}
+
+/**
+ * \brief           Get number of CLUT loads
+ */
+size_t
+dma2d_model_getclutcount(void) {
+    return clut_count;
+}
+
+/**
+ * \brief           Get number of transfers started while CLUT was loading
+ */
+size_t
+dma2d_model_geterrorcount(void) {
+    return error_count;
+}
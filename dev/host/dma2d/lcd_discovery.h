@@ -0,0 +1,105 @@
+/**	
+ * \file            lcd_discovery.h
+ * \brief           Host model of DMA2D peripheral for STM32 DMA2D driver
+ *
+ *                  Replaces board header when driver is built on host.
+ *                  Registers are plain memory, model threads execute operations
+ *                  written to them and call DMA2D_IRQHandler the same way as NVIC does.
+ *                  Only ARGB8888 output is modelled.
+ */
+#ifndef __LCD_DISCOVERY_H
+#define __LCD_DISCOVERY_H
+
+#include "stdint.h"
+#include "stddef.h"
+
+/**
+ * \brief           DMA2D registers
+ */
+typedef struct {
+    volatile uint32_t CR, ISR, IFCR, FGMAR, FGOR, BGMAR, BGOR, FGPFCCR, FGCOLR, BGPFCCR, BGCOLR, FGCMAR, BGCMAR, OPFCCR, OCOLR, OMAR, OOR, NLR;
+} DMA2D_TypeDef;
+
+extern DMA2D_TypeDef dma2d_regs;
+#define DMA2D                       (&dma2d_regs)
+
+typedef struct {
+    DMA2D_TypeDef* Instance;
+} DMA2D_HandleTypeDef;
+
+typedef enum {
+    DMA2D_IRQn = 90,
+} IRQn_Type;
+
+/* Register bits with the same values as on STM32F7 */
+#define DMA2D_CR_START              0x00000001UL
+#define DMA2D_CR_TEIE               0x00000100UL
+#define DMA2D_CR_TCIE               0x00000200UL
+#define DMA2D_CR_CTCIE              0x00001000UL
+#define DMA2D_CR_MODE               0x00030000UL
+
+#define DMA2D_ISR_TEIF              0x00000001UL
+#define DMA2D_ISR_TCIF              0x00000002UL
+#define DMA2D_ISR_CTCIF             0x00000010UL
+
+#define DMA2D_IFCR_CTEIF            0x00000001UL
+#define DMA2D_IFCR_CTCIF            0x00000002UL
+#define DMA2D_IFCR_CCTCIF           0x00000010UL
+
+#define DMA2D_FGPFCCR_CM            0x0000000FUL
+#define DMA2D_FGPFCCR_CCM           0x00000010UL
+#define DMA2D_FGPFCCR_START         0x00000020UL
+#define DMA2D_FGPFCCR_CS_Pos        8
+#define DMA2D_FGPFCCR_CS            0x0000FF00UL
+#define DMA2D_FGPFCCR_AM_Pos        16
+#define DMA2D_FGPFCCR_AM_0          0x00010000UL
+#define DMA2D_FGPFCCR_AM_1          0x00020000UL
+#define DMA2D_FGPFCCR_AI            0x00100000UL
+#define DMA2D_FGPFCCR_RBS           0x00200000UL
+#define DMA2D_FGPFCCR_ALPHA_Pos     24
+
+#define DMA2D_M2M                   0x00000000UL
+#define DMA2D_M2M_PFC               0x00010000UL
+#define DMA2D_M2M_BLEND             0x00020000UL
+#define DMA2D_R2M                   0x00030000UL
+
+#define DMA2D_INPUT_ARGB8888        0x00UL
+#define DMA2D_INPUT_RGB888          0x01UL
+#define DMA2D_INPUT_RGB565          0x02UL
+#define DMA2D_INPUT_L8              0x05UL
+#define DMA2D_INPUT_L4              0x08UL
+#define DMA2D_INPUT_A8              0x09UL
+#define DMA2D_INPUT_A4              0x0AUL
+
+#define DMA2D_OUTPUT_ARGB8888       0x00UL
+#define DMA2D_OUTPUT_RGB565         0x02UL
+#define DMA2D_CCM_ARGB8888          0x00UL
+#define LTDC_PIXEL_FORMAT_ARGB8888  0x00UL
+
+/* Board setup */
+#define LCD_COLOR_FORMAT_ARGB8888
+#define LCD_WIDTH                   480
+#define LCD_HEIGHT                  272
+#define LCD_PIXEL_SIZE              4
+#define LCD_FRAME_BUFFER            ((uint32_t)(uintptr_t)dma2d_model_frame)
+#define LCD_FRAME_BUFFER_SIZE       (LCD_WIDTH * LCD_HEIGHT * LCD_PIXEL_SIZE)
+#define GUI_LAYERS                  2
+#define SDRAM_HEAP_SIZE             0x10000
+
+extern uint32_t dma2d_model_frame[GUI_LAYERS][LCD_WIDTH * LCD_HEIGHT];
+
+void    HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t prio, uint32_t subprio);
+void    HAL_NVIC_EnableIRQ(IRQn_Type irq);
+void    HAL_NVIC_DisableIRQ(IRQn_Type irq);
+void    TM_SDRAM_Init(void);
+void    _LCD_Init(void);
+
+void    DMA2D_IRQHandler(void);
+
+void    dma2d_model_start(uint32_t delay_ns);
+void    dma2d_model_stop(void);
+size_t  dma2d_model_getopcount(void);
+size_t  dma2d_model_getclutcount(void);
+size_t  dma2d_model_geterrorcount(void);
+
+#endif /* __LCD_DISCOVERY_H */
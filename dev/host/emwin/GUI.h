@@ -0,0 +1,26 @@
+/**	
+ * \file            GUI.h
+ * \brief           Minimal emWin bitmap definitions to build images from emWin Bitmap Converter on host
+ */
+#ifndef __EMWIN_GUI_H
+#define __EMWIN_GUI_H
+
+#include "stddef.h"
+
+#define GUI_CONST_STORAGE           const
+#define GUI_DRAW_BMP24              NULL
+
+/**
+ * \brief           emWin bitmap structure
+ */
+typedef struct {
+    unsigned short XSize;
+    unsigned short YSize;
+    unsigned short BytesPerLine;
+    unsigned short BitsPerPixel;
+    const unsigned char* pData;
+    const void* pPal;
+    const void* pMethods;
+} GUI_BITMAP;
+
+#endif /* __EMWIN_GUI_H */
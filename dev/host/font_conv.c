@@ -0,0 +1,136 @@
+/**
+ * \file            font_conv.c
+ * \brief           Convert font linked to tool to C source of font with 4-bit or 8-bit alpha
+ *
+ *                  Usage: `font_conv <font> <bpp> <first> <last> <name>`
+ *
+ *                  Characters from `first` to `last` of linked font `font` are written to standard output
+ *                  with \ref GUI_FLAG_FONT_A4 for `bpp` 4 or \ref GUI_FLAG_FONT_A8 for `bpp` 8.
+ *                  Font structure is named `GUI_Font_<name>`. Source fonts with 1 bit per pixel,
+ *                  2 bits per pixel with \ref GUI_FLAG_FONT_AA, and alpha fonts are supported.
+ *                  Anti-aliased fonts are converted without loss of alpha values.
+ */
+#include "gui/gui.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+extern gui_const gui_font_t GUI_Font_Arial_Bold_18;
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_22;
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_21_AA;
+
+/**
+ * \brief           Font linked to tool
+ */
+typedef struct {
+    const char* name;                               /*!< Name used on command line */
+    const gui_font_t* font;                         /*!< Font structure */
+} font_entry_t;
+
+static const font_entry_t fonts[] = {
+    {"Arial_Bold_18", &GUI_Font_Arial_Bold_18},
+    {"Arial_Narrow_Italic_22", &GUI_Font_Arial_Narrow_Italic_22},
+    {"Arial_Narrow_Italic_21_AA", &GUI_Font_Arial_Narrow_Italic_21_AA},
+};
+
+/**
+ * \brief           Get 8-bit alpha of character pixel
+ * \param[in]       font: Source font
+ * \param[in]       c: Character of font
+ * \param[in]       x: Column of pixel
+ * \param[in]       y: Line of pixel
+ * \return          Alpha value between `0` and `255`
+ */
+static uint8_t
+get_alpha(const gui_font_t* font, const gui_font_char_t* c, int x, int y) {
+    static const uint8_t aa[] = {0x00, 0x55, 0xAA, 0xFF};
+    const uint8_t* data;
+
+    if (font->flags & GUI_FLAG_FONT_A8) {
+        return c->data[y * c->x_size + x];
+    } else if (font->flags & GUI_FLAG_FONT_A4) {
+        data = &c->data[y * ((c->x_size + 1) >> 1) + (x >> 1)];
+        return ((x & 0x01) ? (*data >> 4) : (*data & 0x0F)) * 0x11;
+    } else if (font->flags & GUI_FLAG_FONT_AA) {
+        data = &c->data[y * ((c->x_size + 3) >> 2) + (x >> 2)];
+        return aa[(*data >> (6 - 2 * (x & 0x03))) & 0x03];
+    }
+    data = &c->data[y * ((c->x_size + 7) >> 3) + (x >> 3)];
+    return (*data & (0x80 >> (x & 0x07))) ? 0xFF : 0x00;
+}
+
+int
+main(int argc, char** argv) {
+    const gui_font_t* font = NULL;
+    const gui_font_char_t* c;
+    unsigned long first, last, ch;
+    size_t i, size, total = 0;
+    int bpp, x, y, line;
+    uint8_t a;
+
+    if (argc != 6) {
+        fprintf(stderr, "Usage: %s <font> <bpp> <first> <last> <name>\n", argv[0]);
+        return 1;
+    }
+    for (i = 0; i < GUI_COUNT_OF(fonts); i++) {
+        if (!strcmp(argv[1], fonts[i].name)) {
+            font = fonts[i].font;
+        }
+    }
+    bpp = atoi(argv[2]);
+    first = strtoul(argv[3], NULL, 0);
+    last = strtoul(argv[4], NULL, 0);
+    if (font == NULL) {
+        fprintf(stderr, "Unknown font %s, linked fonts are:\n", argv[1]);
+        for (i = 0; i < GUI_COUNT_OF(fonts); i++) {
+            fprintf(stderr, "    %s\n", fonts[i].name);
+        }
+        return 1;
+    }
+    if ((bpp != 4 && bpp != 8) || first < font->startchar || last > font->endchar || first > last) {
+        fprintf(stderr, "Invalid bits per pixel or character range, supported are 4 and 8 bits per pixel for characters 0x%04X to 0x%04X\n",
+            (unsigned)font->startchar, (unsigned)font->endchar);
+        return 1;
+    }
+
+    printf("/* %s, characters 0x%04lx to 0x%04lx with %d bits per pixel, converted with font_conv */\n", argv[1], first, last, bpp);
+    printf("#include \"gui/gui.h\"\n\n");
+    for (ch = first; ch <= last; ch++) {
+        c = &font->data[ch - font->startchar];
+        line = bpp == 4 ? (c->x_size + 1) >> 1 : c->x_size;
+        size = (size_t)line * c->y_size;
+        total += size;
+        printf("gui_const uint8_t Font_%s_%04lx[%u] = {\n", argv[5], ch, (unsigned)GUI_MAX(size, 1));
+        for (y = 0; y < c->y_size; y++) {
+            printf("   ");
+            for (x = 0; x < c->x_size; x += bpp == 4 ? 2 : 1) {
+                a = get_alpha(font, c, x, y);
+                if (bpp == 8) {
+                    printf(" 0x%02X,", (unsigned)a);
+                } else {                            /* First pixel in low nibble */
+                    printf(" 0x%X%X,", (unsigned)(x + 1 < c->x_size ? get_alpha(font, c, x + 1, y) >> 4 : 0), (unsigned)(a >> 4));
+                }
+            }
+            printf("\n");
+        }
+        if (size == 0) {
+            printf("    0x00,\n");
+        }
+        printf("};\n\n");
+    }
+
+    printf("gui_const gui_font_char_t %s_CharTable[] = {\n", argv[5]);
+    for (ch = first; ch <= last; ch++) {
+        c = &font->data[ch - font->startchar];
+        printf("{%4u, %4u, %2u, %4u, %4u, Font_%s_%04lx},\n", (unsigned)c->x_size, (unsigned)c->y_size,
+            (unsigned)c->x_pos, (unsigned)c->y_pos, (unsigned)c->x_margin, argv[5], ch);
+    }
+    printf("};\n\n");
+    printf("gui_const gui_font_t GUI_Font_%s = {\n", argv[5]);
+    printf("    _GT(\"%s %u bpp\"),\n", font->name, (unsigned)bpp);
+    printf("    %u,\n    0x%04lx,\n    0x%04lx,\n", (unsigned)font->size, first, last);
+    printf("    %s,\n", bpp == 4 ? "GUI_FLAG_FONT_A4" : "GUI_FLAG_FONT_A8");
+    printf("    %s_CharTable\n};\n", argv[5]);
+    fprintf(stderr, "%lu characters, %u bytes of alpha data\n", last - first + 1, (unsigned)total);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**	
+ * \file            gui_ll_host.c
+ * \brief           Low-level port for host builds with frame buffers in memory
+ */
+
+/*
+ * Copyright (c) 2018 Tilen Majerle
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_lcd.h"
+#include "gui/gui_mem.h"
+#include "system/gui_ll.h"
+#include "system/gui_ll_soft.h"
+#include "host.h"
+
+static uint32_t frame[2][HOST_LCD_WIDTH * HOST_LCD_HEIGHT]; /* Frame buffers for 2 layers in ARGB8888 */
+#if GUI_CFG_USE_PARTIAL_BUFFER
+static uint32_t band[HOST_LCD_WIDTH * HOST_PARTIAL_LINES];  /* Partial buffer, flushed to first frame buffer */
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
+static gui_layer_t layers[2];
+static uint8_t heap[HOST_HEAP_SIZE];            /* Memory for GUI allocations */
+
+static void
+host_lcd_init(gui_lcd_t* LCD) {
+
+}
+
+/**
+ * \brief           Get pointer to frame buffer of layer
+ * \param[in]       layer: Layer index, `0` or `1`
+ * \return          Pointer to first pixel of layer
+ */
+uint32_t*
+host_getframe(size_t layer) {
+    return frame[layer];
+}
+
+/**
+ * \brief           Low-level LCD control, see template file for details
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            static GUI_MEM_Region_t region = {heap, sizeof(heap)};
+            gui_ll_t* LL = (gui_ll_t *)param;
+            
+            gui_mem_assignmemory(&region, 1);       /* Assign memory for allocations */
+            
+            LCD->width = HOST_LCD_WIDTH;
+            LCD->height = HOST_LCD_HEIGHT;
+            LCD->pixel_size = 4;
+#if GUI_CFG_USE_PARTIAL_BUFFER
+            layers[0].start_address = (uintptr_t)band;
+            LCD->layer_count = 1;
+            LCD->buffer_size = sizeof(band);
+            gui_ll_soft_setscreen(frame[0]);        /* Bands are copied to first frame buffer */
+#else
+            layers[0].start_address = (uintptr_t)frame[0];
+            layers[1].start_address = (uintptr_t)frame[1];
+            LCD->layer_count = 2;
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
+            LCD->layers = layers;
+            
+            gui_ll_soft_init(LL);                   /* Draw to frame buffers with CPU */
+            LCD->flags |= GUI_FLAG_LCD_CPU_ACCESS;  /* Frame buffers are in host memory */
+            LL->Init = host_lcd_init;
+            
+            if (result != NULL) {
+                *(uint8_t *)result = 0;             /* Successful initialization */
+            }
+            return 1;
+        }
+        case GUI_LL_Command_SetActiveLayer: {
+            gui_layer_t* layer = *(gui_layer_t **)param;
+            
+            gui_lcd_confirmactivelayer(layer == &layers[0] ? 0 : 1);   /* There is no display, layer is shown immediatelly */
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
@@ -0,0 +1,192 @@
+/**	
+ * \file            gui_sys_host.c
+ * \brief           System functions for single threaded host builds
+ */
+
+/*
+ * Copyright (c) 2018 Tilen Majerle
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#define GUI_INTERNAL
+#include "system/gui_sys.h"
+#include "time.h"
+
+/*
+ * Tests and benchmarks call gui_process from main loop.
+ * There is only one thread, protection is not needed and nothing may block.
+ * Message queue only counts pending messages as no-one waits for them.
+ */
+
+static size_t mbox_count;                       /* Number of messages in queue */
+static size_t mbox_size;                        /* Size of message queue */
+
+uint8_t
+gui_sys_init(void) {
+    return 1;
+}
+
+uint32_t
+gui_sys_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);        /* Get monotonic time */
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+uint8_t
+gui_sys_protect(void) {
+    return 1;
+}
+
+uint8_t
+gui_sys_unprotect(void) {
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_create(gui_sys_mutex_t* p) {
+    *p = (gui_sys_mutex_t)p;                    /* Any non-NULL value is valid */
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_delete(gui_sys_mutex_t* p) {
+    *p = GUI_SYS_MUTEX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_lock(gui_sys_mutex_t* p) {
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_unlock(gui_sys_mutex_t* p) {
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_isvalid(gui_sys_mutex_t* p) {
+    return !!*p;
+}
+
+uint8_t
+gui_sys_mutex_invalid(gui_sys_mutex_t* p) {
+    *p = GUI_SYS_MUTEX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_create(gui_sys_sem_t* p, uint8_t cnt) {
+    *p = (gui_sys_sem_t)p;
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_delete(gui_sys_sem_t* p) {
+    *p = GUI_SYS_SEM_NULL;
+    return 1;
+}
+
+uint32_t
+gui_sys_sem_wait(gui_sys_sem_t* p, uint32_t timeout) {
+    return GUI_SYS_TIMEOUT;                     /* Nobody can release semaphore while we wait */
+}
+
+uint8_t
+gui_sys_sem_release(gui_sys_sem_t* p) {
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_isvalid(gui_sys_sem_t* p) {
+    return !!*p;
+}
+
+uint8_t
+gui_sys_sem_invalid(gui_sys_sem_t* p) {
+    *p = GUI_SYS_SEM_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_mbox_create(gui_sys_mbox_t* b, size_t size) {
+    *b = (gui_sys_mbox_t)b;
+    mbox_count = 0;
+    mbox_size = size;
+    return 1;
+}
+
+uint8_t
+gui_sys_mbox_delete(gui_sys_mbox_t* b) {
+    if (mbox_count) {                           /* We still have messages in queue */
+        return 0;
+    }
+    *b = GUI_SYS_MBOX_NULL;
+    return 1;
+}
+
+uint32_t
+gui_sys_mbox_put(gui_sys_mbox_t* b, void* m) {
+    return gui_sys_mbox_putnow(b, m) ? 0 : GUI_SYS_TIMEOUT;
+}
+
+uint32_t
+gui_sys_mbox_get(gui_sys_mbox_t* b, void** m, uint32_t timeout) {
+    return gui_sys_mbox_getnow(b, m) ? 0 : GUI_SYS_TIMEOUT;  /* Never wait, caller processes anyway */
+}
+
+uint8_t
+gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m) {
+    if (mbox_count < mbox_size) {
+        mbox_count++;
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t
+gui_sys_mbox_getnow(gui_sys_mbox_t* b, void** m) {
+    if (mbox_count) {
+        mbox_count--;
+        *m = NULL;
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t
+gui_sys_mbox_isvalid(gui_sys_mbox_t* b) {
+    return !!*b;
+}
+
+uint8_t
+gui_sys_mbox_invalid(gui_sys_mbox_t* b) {
+    *b = GUI_SYS_MBOX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_thread_create(gui_sys_thread_t* t, const char* name, void (*thread_func)(void *), void* const arg, size_t stack_size, gui_sys_thread_prio_t prio) {
+    return 0;                                   /* No threads, gui_process is called from main loop */
+}
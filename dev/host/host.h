@@ -0,0 +1,40 @@
+/**	
+ * \file            host.h
+ * \brief           Helpers for host tests and benchmarks
+ */
+#ifndef __HOST_H
+#define __HOST_H
+
+#include "stdint.h"
+#include "stddef.h"
+#include "time.h"
+
+#ifndef HOST_LCD_WIDTH
+#define HOST_LCD_WIDTH                  480
+#endif
+
+#ifndef HOST_LCD_HEIGHT
+#define HOST_LCD_HEIGHT                 272
+#endif
+
+#ifndef HOST_PARTIAL_LINES
+#define HOST_PARTIAL_LINES              10
+#endif
+
+#ifndef HOST_HEAP_SIZE
+#define HOST_HEAP_SIZE                  0x40000
+#endif
+
+uint32_t*   host_getframe(size_t layer);
+
+/**
+ * \brief           Get monotonic time in units of nanoseconds
+ */
+static inline uint64_t
+host_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* __HOST_H */
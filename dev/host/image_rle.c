@@ -0,0 +1,60 @@
+/**	
+ * \file            image_rle.c
+ * \brief           Run-length encoder for images with GUI_IMAGE_FLAG_RLE
+ *
+ *                  Output follows format described in \ref GUI_IMAGE_FLAG_RLE.
+ *                  Runs of 2 or more equal pixels are stored as repeat packets,
+ *                  other pixels are collected to literal packets.
+ */
+#include "image_rle.h"
+#include "string.h"
+
+/**
+ * \brief           Encode image to run-length encoded format
+ * \param[in]       data: Uncompressed image data, lines of `x_size` pixels without padding
+ * \param[in]       x_size: Image width in units of pixels
+ * \param[in]       y_size: Image height in units of pixels
+ * \param[in]       bpp: Bits per pixel, `8` or more
+ * \param[out]      out: Output buffer or `NULL` to get only size of encoded image
+ * \return          Number of bytes of encoded image
+ */
+size_t
+image_rle_encode(const uint8_t* data, gui_dim_t x_size, gui_dim_t y_size, uint8_t bpp, uint8_t* out) {
+    size_t bytes = bpp >> 3, o = 4 * (size_t)y_size;
+    const uint8_t* line;
+    gui_dim_t x, y, n;
+    
+    for (y = 0; y < y_size; y++) {
+        if (out != NULL) {                          /* Save line offset to index table */
+            out[4 * y + 0] = (uint8_t)(o);
+            out[4 * y + 1] = (uint8_t)(o >> 8);
+            out[4 * y + 2] = (uint8_t)(o >> 16);
+            out[4 * y + 3] = (uint8_t)(o >> 24);
+        }
+        line = &data[(size_t)y * x_size * bytes];
+        for (x = 0; x < x_size; x += n) {
+            for (n = 1; (x + n) < x_size && n < 128 && !memcmp(&line[(x + n) * bytes], &line[x * bytes], bytes); n++);
+            if (n > 1) {                            /* Repeat packet */
+                if (out != NULL) {
+                    out[o] = 0x80 | (uint8_t)(n - 1);
+                    memcpy(&out[o + 1], &line[x * bytes], bytes);
+                }
+                o += 1 + bytes;
+                continue;
+            }
+            
+            /* Literal packet ends before next run of equal pixels */
+            for (; (x + n) < x_size && n < 128; n++) {
+                if ((x + n + 1) < x_size && !memcmp(&line[(x + n) * bytes], &line[(x + n + 1) * bytes], bytes)) {
+                    break;
+                }
+            }
+            if (out != NULL) {
+                out[o] = (uint8_t)(n - 1);
+                memcpy(&out[o + 1], &line[x * bytes], n * bytes);
+            }
+            o += 1 + n * bytes;
+        }
+    }
+    return o;
+}
@@ -0,0 +1,12 @@
+/**	
+ * \file            image_rle.h
+ * \brief           Run-length encoder for images with GUI_IMAGE_FLAG_RLE
+ */
+#ifndef __IMAGE_RLE_H
+#define __IMAGE_RLE_H
+
+#include "gui/gui.h"
+
+size_t  image_rle_encode(const uint8_t* data, gui_dim_t x_size, gui_dim_t y_size, uint8_t bpp, uint8_t* out);
+
+#endif /* __IMAGE_RLE_H */
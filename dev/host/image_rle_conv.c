@@ -0,0 +1,68 @@
+/**
+ * \file            image_rle_conv.c
+ * \brief           Convert raw image file to C source of run-length encoded image
+ *
+ *                  Usage: `image_rle <input> <x_size> <y_size> <bpp> <name>`
+ *
+ *                  Input file holds lines of `x_size` pixels without padding, in format used by GUI library
+ *                  for given bits per pixel. Source with \ref gui_image_desc_t named `name` and
+ *                  \ref GUI_IMAGE_FLAG_RLE flag is written to standard output.
+ *                  Palette of L8 image must be set by application.
+ */
+#include "image_rle.h"
+#include "stdio.h"
+#include "stdlib.h"
+
+int
+main(int argc, char** argv) {
+    size_t size, rle_size, i;
+    uint8_t *data, *rle;
+    int x_size, y_size, bpp;
+    FILE* f;
+
+    if (argc != 6) {
+        fprintf(stderr, "Usage: %s <input> <x_size> <y_size> <bpp> <name>\n", argv[0]);
+        return 1;
+    }
+    x_size = atoi(argv[2]);
+    y_size = atoi(argv[3]);
+    bpp = atoi(argv[4]);
+    if (x_size <= 0 || y_size <= 0 || (bpp != 8 && bpp != 16 && bpp != 24 && bpp != 32)) {
+        fprintf(stderr, "Invalid size or bits per pixel, supported are 8, 16, 24 and 32\n");
+        return 1;
+    }
+    size = (size_t)x_size * y_size * (bpp >> 3);
+    data = malloc(size);
+    if (data == NULL || (f = fopen(argv[1], "rb")) == NULL) {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+    if (fread(data, 1, size, f) != size) {
+        fprintf(stderr, "File %s is smaller than %u bytes\n", argv[1], (unsigned)size);
+        fclose(f);
+        return 1;
+    }
+    fclose(f);
+
+    rle_size = image_rle_encode(data, x_size, y_size, bpp, NULL);
+    rle = malloc(rle_size);
+    if (rle == NULL) {
+        return 1;
+    }
+    image_rle_encode(data, x_size, y_size, bpp, rle);
+
+    printf("/* %dx%d %dbpp, run-length encoded %u bytes, uncompressed %u bytes */\n",
+        x_size, y_size, bpp, (unsigned)rle_size, (unsigned)size);
+    printf("#include \"gui/gui.h\"\n\n");
+    printf("static const uint8_t %s_data[] = {", argv[5]);
+    for (i = 0; i < rle_size; i++) {
+        printf("%s0x%02X,", (i % 16) ? " " : "\n    ", (unsigned)rle[i]);
+    }
+    printf("\n};\n\n");
+    printf("const gui_image_desc_t %s = {\n", argv[5]);
+    printf("    .x_size = %d,\n    .y_size = %d,\n    .bpp = %d,\n", x_size, y_size, bpp);
+    printf("    .image = %s_data,\n    .flags = GUI_IMAGE_FLAG_RLE,\n};\n", argv[5]);
+    free(rle);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file            test_char_fallback.c
+ * \brief           Characters drawn without low-level character copy
+ *
+ *                  Text is drawn with \ref gui_ll_t.CopyChar of software driver as reference.
+ *                  Same text is then drawn with character copy functions removed from driver,
+ *                  once written directly to frame buffer with \ref GUI_FLAG_LCD_CPU_ACCESS
+ *                  and once with \ref gui_ll_t.GetPixel and \ref gui_ll_t.SetPixel only.
+ *                  Both must draw the same pixels as reference for random fonts with 1 and 2 bits per pixel
+ *                  and 4-bit alpha, positions, clipping regions, color splits and backgrounds.
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_draw.h"
+#include "host.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define CHECKS              3000
+
+extern gui_const gui_font_t GUI_Font_Arial_Bold_18;
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_22;
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_21_AA;
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_21_A4;
+
+static const gui_font_t* fonts[] = {
+    &GUI_Font_Arial_Bold_18,
+    &GUI_Font_Arial_Narrow_Italic_22,
+    &GUI_Font_Arial_Narrow_Italic_21_AA,
+    &GUI_Font_Arial_Narrow_Italic_21_A4,
+};
+
+static const gui_char* texts[] = {
+    _GT("Hello World"),
+    _GT("AVAWAy fjq|"),
+    _GT("0123456789 %&@"),
+    _GT("ij,;:!"),
+};
+
+static uint32_t background[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+static uint32_t ref[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+static uint32_t* frame;                             /* Frame buffer of drawing layer */
+
+/**
+ * \brief           Draw text to frame with background
+ * \param[in]       disp: Clipping region
+ * \param[in]       font: Font to use
+ * \param[in]       text: Text to draw
+ * \param[in]       draw: Drawing parameters
+ */
+static void
+draw_text(const gui_display_t* disp, const gui_font_t* font, const gui_char* text, const gui_draw_font_t* draw) {
+    gui_draw_font_t d = *draw;                      /* Structure is changed by drawing */
+
+    memcpy(frame, background, sizeof(background));
+    gui_draw_writetext(disp, font, text, &d);
+    guii_draw_flush();
+}
+
+int
+main(void) {
+    gui_ll_t ll;
+    gui_display_t disp;
+    gui_draw_font_t draw;
+    const gui_font_t* font;
+    const gui_char* text;
+    size_t i, k, drawn = 0, errors_direct = 0, errors_pixel = 0;
+
+    if (gui_init() != guiOK) {
+        printf("gui_init failed\n");
+        return 1;
+    }
+    frame = (uint32_t *)GUI.lcd.drawing_layer->start_address;
+    ll = GUI.ll;                                    /* Driver with character copy */
+
+    srand(5);
+    for (i = 0; i < CHECKS; i++) {
+        font = fonts[rand() % GUI_COUNT_OF(fonts)];
+        text = texts[rand() % GUI_COUNT_OF(texts)];
+
+        disp.x1 = rand() % 200;
+        disp.y1 = rand() % 100;
+        disp.x2 = disp.x1 + 1 + rand() % 250;
+        disp.y2 = disp.y1 + 1 + rand() % 60;
+
+        gui_draw_font_init(&draw);
+        draw.x = disp.x1 - 20 + rand() % 40;
+        draw.y = disp.y1 - 15 + rand() % 30;
+        draw.width = 300;
+        draw.height = 5 + rand() % 40;              /* Text may be higher than rectangle */
+        draw.align = GUI_HALIGN_LEFT | GUI_VALIGN_TOP;
+        draw.color1width = rand() % 2 ? rand() % 200 : draw.width;
+        draw.color1 = 0xFF000000UL | (rand() & 0xFFFFFF);
+        draw.Color2 = 0xFF000000UL | (rand() & 0xFFFFFF);
+
+        for (k = 0; k < GUI_COUNT_OF(background); k++) {
+            background[k] = i & 0x01 ? (0xFF000000UL | (rand() & 0xFFFFFF)) : 0xFF000000UL | (k * 0x10101UL);
+        }
+
+        /* Reference with character copy of driver */
+        GUI.ll = ll;
+        GUI.lcd.flags |= GUI_FLAG_LCD_CPU_ACCESS;
+        draw_text(&disp, font, text, &draw);
+        memcpy(ref, frame, sizeof(ref));
+        drawn += memcmp(ref, background, sizeof(ref)) != 0;
+
+        /* Direct write to frame buffer */
+        GUI.ll.CopyChar = NULL;
+        GUI.ll.CopyCharA4 = NULL;
+        GUI.ll.CopyChars = NULL;
+        draw_text(&disp, font, text, &draw);
+        if (memcmp(ref, frame, sizeof(ref))) {
+            errors_direct++;
+        }
+
+        /* Pixel by pixel with low-level driver */
+        GUI.lcd.flags &= ~GUI_FLAG_LCD_CPU_ACCESS;
+        draw_text(&disp, font, text, &draw);
+        if (memcmp(ref, frame, sizeof(ref))) {
+            errors_pixel++;
+        }
+    }
+    GUI.ll = ll;
+    GUI.lcd.flags |= GUI_FLAG_LCD_CPU_ACCESS;
+
+    printf("checks %u, visible %u, errors direct %u, errors pixel %u\n",
+        (unsigned)CHECKS, (unsigned)drawn, (unsigned)errors_direct, (unsigned)errors_pixel);
+    return errors_direct || errors_pixel || drawn == 0;
+}
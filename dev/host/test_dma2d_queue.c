@@ -0,0 +1,178 @@
+/**	
+ * \file            test_dma2d_queue.c
+ * \brief           Ordering of queued operations in STM32 DMA2D driver
+ *
+ *                  Driver is built against host model of DMA2D peripheral, see dma2d/dma2d_model.c.
+ *                  Random overlapping fills, copies, characters and indexed images are drawn
+ *                  while model executes them slower than they are queued.
+ *                  Palette colors are also changed in place, with new palette generation.
+ *                  Result must be equal to drawing the same operations one after another with CPU,
+ *                  also when pixels are read back while operations are still in queue.
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "system/gui_ll.h"
+#include "lcd_discovery.h"
+#include "stdio.h"
+#include "string.h"
+
+#define W                   LCD_WIDTH
+#define H                   LCD_HEIGHT
+#define OPERATIONS          5000
+
+static uint32_t ref[W * H];                         /* Reference drawn with CPU */
+static uint32_t src[64 * 64];                       /* Source image for copy */
+static uint8_t mask[32 * 32];                       /* Alpha mask for characters */
+static uint8_t indexed[64 * 64];                    /* L8 image */
+static gui_color_t palettes[2][256];
+static uint8_t palette_gens[2];
+
+static uint32_t seed = 1;
+
+static uint32_t
+rnd(uint32_t max) {
+    seed = seed * 1103515245UL + 12345;
+    return (seed >> 8) % max;
+}
+
+/**
+ * \brief           Get random rectangle inside screen with size up to max
+ */
+static void
+rnd_rect(gui_dim_t max, gui_dim_t* x, gui_dim_t* y, gui_dim_t* w, gui_dim_t* h) {
+    *w = 1 + rnd(max);
+    *h = 1 + rnd(max);
+    *x = rnd(W - *w + 1);
+    *y = rnd(H - *h + 1);
+}
+
+int
+main(void) {
+    gui_layer_t* layer;
+    uint32_t* frame;
+    size_t i, errors = 0, submitted = 0, readbacks = 0;
+    gui_dim_t x, y, w, h, r, c;
+    
+    for (i = 0; i < GUI_COUNT_OF(src); i++) {
+        src[i] = 0xFF000000UL | rnd(0x1000000);
+        indexed[i] = rnd(256);
+    }
+    for (i = 0; i < GUI_COUNT_OF(mask); i++) {
+        mask[i] = rnd(2) ? 0xFF : 0x00;             /* Fully covered or empty pixels give exact result */
+    }
+    for (i = 0; i < 256; i++) {
+        palettes[0][i] = 0xFF000000UL | rnd(0x1000000);
+        palettes[1][i] = 0xFF000000UL | rnd(0x1000000);
+    }
+    
+    gui_ll_control(&GUI.lcd, GUI_LL_Command_Init, &GUI.ll, NULL);
+    GUI.ll.Init(&GUI.lcd);
+    layer = &GUI.lcd.layers[0];
+    layer->width = W;
+    layer->height = H;
+    frame = (uint32_t *)layer->start_address;
+    
+    dma2d_model_start(2000);                        /* Model is slower than CPU, queue fills up */
+    for (i = 0; i < OPERATIONS; i++) {
+        gui_color_t color = 0xFF000000UL | rnd(0x1000000);
+        
+        switch (rnd(6)) {
+            case 0: {                               /* Fill rectangle */
+                rnd_rect(100, &x, &y, &w, &h);
+                GUI.ll.FillRect(&GUI.lcd, layer, x, y, w, h, color);
+                for (r = 0; r < h; r++) {
+                    for (c = 0; c < w; c++) {
+                        ref[(y + r) * W + x + c] = color;
+                    }
+                }
+                submitted++;
+                break;
+            }
+            case 1: {                               /* Batch of rectangles */
+                gui_ll_rect_t rects[4];
+                size_t k, n = 1 + rnd(4);
+                for (k = 0; k < n; k++) {
+                    rnd_rect(40, &rects[k].x, &rects[k].y, &rects[k].width, &rects[k].height);
+                    for (r = 0; r < rects[k].height; r++) {
+                        for (c = 0; c < rects[k].width; c++) {
+                            ref[(rects[k].y + r) * W + rects[k].x + c] = color;
+                        }
+                    }
+                }
+                GUI.ll.FillRects(&GUI.lcd, layer, rects, n, color);
+                submitted += n;
+                break;
+            }
+            case 2: {                               /* Copy image */
+                rnd_rect(64, &x, &y, &w, &h);
+                GUI.ll.Copy(&GUI.lcd, layer, src, &frame[y * W + x], w, h, 64 - w, W - w);
+                for (r = 0; r < h; r++) {
+                    memcpy(&ref[(y + r) * W + x], &src[r * 64], w * 4);
+                }
+                submitted++;
+                break;
+            }
+            case 3: {                               /* Character with alpha mask */
+                rnd_rect(32, &x, &y, &w, &h);
+                GUI.ll.CopyChar(&GUI.lcd, layer, mask, &frame[y * W + x], w, h, 32 - w, W - w, color);
+                for (r = 0; r < h; r++) {
+                    for (c = 0; c < w; c++) {
+                        if (mask[r * 32 + c]) {
+                            ref[(y + r) * W + x + c] = 0xFF000000UL | color;
+                        }
+                    }
+                }
+                submitted++;
+                break;
+            }
+            case 4: {                               /* Indexed image, palette may change between draws */
+                gui_image_desc_t img = {0};
+                size_t p = rnd(2);
+                gui_color_t* pal = palettes[p];
+                
+                if (!rnd(8)) {                      /* Change palette colors in place */
+                    while (!GUI.ll.IsReady(&GUI.lcd));  /* Palette may still be used by DMA2D */
+                    for (c = 0; c < 256; c++) {
+                        pal[c] = 0xFF000000UL | rnd(0x1000000);
+                    }
+                    palette_gens[p]++;
+                }
+                img.bpp = 8;
+                img.palette = pal;
+                img.palette_size = 256;
+                img.palette_gen = palette_gens[p];
+                rnd_rect(64, &x, &y, &w, &h);
+                GUI.ll.DrawImageIndexed(&GUI.lcd, layer, &img, indexed, &frame[y * W + x], w, h, 64 - w, W - w);
+                for (r = 0; r < h; r++) {
+                    for (c = 0; c < w; c++) {
+                        ref[(y + r) * W + x + c] = pal[indexed[r * 64 + c]];
+                    }
+                }
+                submitted++;
+                break;
+            }
+            default: {                              /* Read back pixel while operations are queued */
+                x = rnd(W);
+                y = rnd(H);
+                if (GUI.ll.GetPixel(&GUI.lcd, layer, x, y) != ref[y * W + x]) {
+                    errors++;
+                }
+                readbacks++;
+                break;
+            }
+        }
+    }
+    while (!GUI.ll.IsReady(&GUI.lcd));             /* Wait for queue to empty */
+    dma2d_model_stop();
+    
+    for (i = 0; i < W * H; i++) {
+        if (frame[i] != ref[i]) {
+            errors++;
+        }
+    }
+    errors += dma2d_model_geterrorcount();          /* Transfers started during CLUT loading */
+    printf("operations %u, transfers %u/%u, CLUT loads %u, readbacks %u, errors %u\n",
+        (unsigned)OPERATIONS, (unsigned)dma2d_model_getopcount(), (unsigned)submitted,
+        (unsigned)dma2d_model_getclutcount(), (unsigned)readbacks, (unsigned)errors);
+    return errors || dma2d_model_getopcount() != submitted;
+}
@@ -0,0 +1,123 @@
+/**
+ * \file            test_font_a4.c
+ * \brief           Font with 4-bit alpha drawn from font data
+ *
+ *                  `src/fonts/Arial_Narrow_Italic_A4.c` is converted with `font_conv` from anti-aliased font
+ *                  without loss of alpha values. Text drawn with it must have the same pixels as text
+ *                  drawn with anti-aliased font through RAM cache, for random positions, clipping regions and color splits,
+ *                  with \ref gui_ll_t.CopyCharA4 of software driver and without it.
+ *                  Characters of font with 4-bit alpha must never be looked up in or added to RAM cache.
+ *
+ *                  Test is built also with \ref GUI_CFG_TEXT_LINE_BUFFER_SIZE, where characters are composed to text line.
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_draw.h"
+#include "host.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define CHECKS              3000
+
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_21_AA;
+extern gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_21_A4;
+
+static const gui_char* texts[] = {
+    _GT("Hello World"),
+    _GT("AVAWAy fjq|"),
+    _GT("0123456789 %&@"),
+    _GT("ij,;:! {[()]}"),
+};
+
+static uint32_t background[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+static uint32_t ref[HOST_LCD_WIDTH * HOST_LCD_HEIGHT];
+static uint32_t* frame;                             /* Frame buffer of drawing layer */
+
+/**
+ * \brief           Draw text to frame with background
+ * \param[in]       disp: Clipping region
+ * \param[in]       font: Font to use
+ * \param[in]       text: Text to draw
+ * \param[in]       draw: Drawing parameters
+ */
+static void
+draw_text(const gui_display_t* disp, const gui_font_t* font, const gui_char* text, const gui_draw_font_t* draw) {
+    gui_draw_font_t d = *draw;                      /* Structure is changed by drawing */
+
+    memcpy(frame, background, sizeof(background));
+    gui_draw_writetext(disp, font, text, &d);
+    guii_draw_flush();
+}
+
+int
+main(void) {
+    gui_ll_t ll;
+    gui_display_t disp;
+    gui_draw_font_t draw;
+    gui_font_cache_stats_t before, after;
+    const gui_char* text;
+    size_t i, k, drawn = 0, errors_a4 = 0, errors_lines = 0, cache = 0;
+
+    if (gui_init() != guiOK) {
+        printf("gui_init failed\n");
+        return 1;
+    }
+    frame = (uint32_t *)GUI.lcd.drawing_layer->start_address;
+    ll = GUI.ll;
+
+    srand(7);
+    for (i = 0; i < CHECKS; i++) {
+        text = texts[rand() % GUI_COUNT_OF(texts)];
+
+        disp.x1 = rand() % 200;
+        disp.y1 = rand() % 100;
+        disp.x2 = disp.x1 + 1 + rand() % 250;
+        disp.y2 = disp.y1 + 1 + rand() % 60;
+
+        gui_draw_font_init(&draw);
+        draw.x = disp.x1 - 20 + rand() % 40;
+        draw.y = disp.y1 - 15 + rand() % 30;
+        draw.width = 300;
+        draw.height = 40;
+        draw.align = GUI_HALIGN_LEFT | GUI_VALIGN_TOP;
+        draw.color1width = rand() % 2 ? rand() % 200 : draw.width;
+        draw.color1 = 0xFF000000UL | (rand() & 0xFFFFFF);
+        draw.Color2 = 0xFF000000UL | (rand() & 0xFFFFFF);
+
+        for (k = 0; k < GUI_COUNT_OF(background); k++) {
+            background[k] = 0xFF000000UL | (rand() & 0xFFFFFF);
+        }
+
+        /* Reference with anti-aliased font from RAM cache */
+        GUI.ll = ll;
+        draw_text(&disp, &GUI_Font_Arial_Narrow_Italic_21_AA, text, &draw);
+        memcpy(ref, frame, sizeof(ref));
+        drawn += memcmp(ref, background, sizeof(ref)) != 0;
+
+        gui_draw_font_getcachestats(&before);
+
+        /* 4-bit alpha copied by driver, or expanded line by line when not starting on byte */
+        draw_text(&disp, &GUI_Font_Arial_Narrow_Italic_21_A4, text, &draw);
+        if (memcmp(ref, frame, sizeof(ref))) {
+            errors_a4++;
+        }
+
+        /* Every line expanded before copy */
+        GUI.ll.CopyCharA4 = NULL;
+        draw_text(&disp, &GUI_Font_Arial_Narrow_Italic_21_A4, text, &draw);
+        if (memcmp(ref, frame, sizeof(ref))) {
+            errors_lines++;
+        }
+
+        gui_draw_font_getcachestats(&after);
+        if (after.hits != before.hits || after.misses != before.misses || after.count != before.count) {
+            cache++;
+        }
+    }
+    GUI.ll = ll;
+
+    printf("checks %u, visible %u, errors A4 copy %u, errors line copy %u, cache used %u\n", (unsigned)CHECKS,
+        (unsigned)drawn, (unsigned)errors_a4, (unsigned)errors_lines, (unsigned)cache);
+    return errors_a4 || errors_lines || cache || drawn == 0;
+}
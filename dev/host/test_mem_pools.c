@@ -0,0 +1,230 @@
+/**
+ * \file            test_mem_pools.c
+ * \brief           Reservation of block pools and dialog churn with pools
+ *
+ *                  Library is built with \ref GUI_CFG_USE_MEM_POOLS enabled, with first-fit and TLSF allocator.
+ *                  Assignment of region too small for pools must fail and leave no region assigned.
+ *                  Pools must be placed at the start of fast region, which is used first for metadata.
+ *
+ *                  Dialogs with widget sized objects and heap buffers open and close over
+ *                  a fixed set of long-lived widgets, which reallocate their texts.
+ *                  Content of each block is checked before it is freed,
+ *                  no allocation may fall back to heap because pool is full.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "gui/gui_mem.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define DIALOGS             200000
+#define WIDGETS             64
+#define DIALOG_OBJECTS      32
+#define SAMPLE_PERIOD       1000
+
+static uint8_t heap_small[1024];
+static uint8_t heap_slow[32 * 1024];
+static uint8_t heap_fast[192 * 1024];
+
+/**
+ * \brief           Allocated object with known content
+ */
+typedef struct {
+    uint8_t* ptr;                                   /*!< Allocated memory */
+    size_t size;                                    /*!< Requested size */
+    uint8_t tag;                                    /*!< Value written to all bytes */
+} object_t;
+
+static object_t widgets[WIDGETS][2];                /* Handle and text of long-lived widgets */
+static object_t dialog[DIALOG_OBJECTS];
+static size_t bad, fails;
+
+/**
+ * \brief           Allocate object and fill it with random tag
+ */
+static void
+object_alloc(object_t* o, size_t size) {
+    o->size = size;
+    o->tag = rand();
+    if ((o->ptr = gui_mem_alloc(size)) == NULL) {
+        fails++;
+        return;
+    }
+    memset(o->ptr, o->tag, size);
+}
+
+/**
+ * \brief           Check content of object
+ */
+static void
+object_check(const object_t* o, size_t size) {
+    size_t i;
+
+    for (i = 0; o->ptr != NULL && i < size; i++) {
+        if (o->ptr[i] != o->tag) {
+            bad++;
+            break;
+        }
+    }
+}
+
+/**
+ * \brief           Check content and free object
+ */
+static void
+object_free(object_t* o) {
+    object_check(o, o->size);
+    gui_mem_free(o->ptr);
+    o->ptr = NULL;
+}
+
+/**
+ * \brief           Reallocate object, content up to smaller size must be kept
+ */
+static void
+object_realloc(object_t* o, size_t size) {
+    uint8_t* ptr;
+
+    if ((ptr = gui_mem_realloc(o->ptr, size)) == NULL) {
+        fails++;
+        return;
+    }
+    o->ptr = ptr;
+    object_check(o, GUI_MIN(o->size, size));
+    o->size = size;
+    o->tag = rand();
+    memset(o->ptr, o->tag, size);
+}
+
+/**
+ * \brief           Get size of largest block which can be allocated outside of pools
+ */
+static size_t
+largest_free(void) {
+    size_t lo = 257, hi = sizeof(heap_fast), mid;
+    void* ptr;
+
+    while (lo < hi) {
+        mid = (lo + hi + 1) / 2;
+        if ((ptr = gui_mem_alloc(mid)) != NULL) {
+            gui_mem_free(ptr);
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+int
+main(void) {
+    GUI_MEM_Region_t small = {heap_small, sizeof(heap_small)};
+    GUI_MEM_Region_t regions[] = {
+        {heap_slow, sizeof(heap_slow), 0},
+        {heap_fast, sizeof(heap_fast), GUI_MEM_REGION_FAST},
+    };
+    gui_mem_region_info_t slow_info, fast_info;
+    gui_mem_pool_info_t pool_info;
+    size_t pools_size = 0, i, k, n, largest, fast_index = 1;
+    double ratio, min_ratio = 1.0;
+    uint8_t* ptr;
+    long d;
+
+    /* Pools do not fit to small region */
+    if (gui_mem_assignmemory(&small, 1) || gui_mem_getfree() != 0) {
+        printf("pools reserved in %u bytes region\n", (unsigned)sizeof(heap_small));
+        return 1;
+    }
+
+    if (&heap_fast[0] < &heap_slow[0]) {            /* Regions must be in rising address order */
+        regions[0] = regions[1];
+        regions[1].StartAddress = heap_slow;
+        regions[1].Size = sizeof(heap_slow);
+        regions[1].Flags = 0;
+        fast_index = 0;
+    }
+    if (!gui_mem_assignmemory(regions, GUI_COUNT_OF(regions))) {
+        printf("Cannot assign memory\n");
+        return 1;
+    }
+    for (i = 0; gui_mem_getpoolinfo(i, &pool_info); i++) {
+        if (!pool_info.blocks) {
+            printf("pool %u not reserved\n", (unsigned)i);
+            return 1;
+        }
+        pools_size += pool_info.blocks * GUI_MEM_ALIGN(GUI_MAX(pool_info.block_size, sizeof(void *)));
+    }
+    gui_mem_getregioninfo(fast_index, &fast_info);
+    gui_mem_getregioninfo(1 - fast_index, &slow_info);
+
+    /* Blocks of first pool start at the beginning of fast region */
+    ptr = gui_mem_alloc(1);
+    printf("pools %u bytes, first block at offset %u of fast region, fast region %u/%u bytes free, slow region %u/%u bytes free\n",
+        (unsigned)pools_size, (unsigned)(ptr - heap_fast), (unsigned)fast_info.free, (unsigned)fast_info.size,
+        (unsigned)slow_info.free, (unsigned)slow_info.size);
+    if (ptr < heap_fast || ptr >= heap_fast + 64 || slow_info.free != slow_info.size
+        || fast_info.size - fast_info.free < pools_size || fast_info.size - fast_info.free > pools_size + 256) {
+        printf("pools not at start of fast region\n");
+        return 1;
+    }
+    gui_mem_free(ptr);
+
+    srand(3);
+    for (i = 0; i < WIDGETS; i++) {
+        object_alloc(&widgets[i][0], 100 + rand() % 150);
+        object_alloc(&widgets[i][1], 4 + rand() % 56);
+    }
+
+    /* Open and close dialogs, long-lived widgets change texts meanwhile */
+    for (d = 0; d < DIALOGS; d++) {
+        n = 4 + rand() % (DIALOG_OBJECTS - 4);
+        for (k = 0; k < n; k++) {
+            int r = rand() % 100;
+            if (r < 40) {
+                object_alloc(&dialog[k], 100 + rand() % 150);  /* Widget handle */
+            } else if (r < 80) {
+                object_alloc(&dialog[k], 4 + rand() % 56);     /* Text, timer or list item */
+            } else {
+                object_alloc(&dialog[k], 300 + rand() % 1500); /* Buffer on heap */
+            }
+        }
+        for (k = 0; k < 2; k++) {
+            object_t* o = &widgets[rand() % WIDGETS][1];
+            object_realloc(o, rand() % 8 ? 4 + rand() % 56 : 300 + rand() % 300);
+        }
+        for (k = n; k > 0; k--) {                   /* Close dialog in random order */
+            i = rand() % k;
+            object_free(&dialog[i]);
+            dialog[i] = dialog[k - 1];
+        }
+        if ((d % SAMPLE_PERIOD) == 0) {             /* Fragmentation of heap in fast region with dialog closed */
+            gui_mem_getregioninfo(fast_index, &fast_info);
+            largest = largest_free();
+            ratio = (double)largest / fast_info.free;
+            if (ratio < min_ratio) {
+                min_ratio = ratio;
+            }
+        }
+    }
+    for (i = 0; i < WIDGETS; i++) {
+        object_free(&widgets[i][0]);
+        object_free(&widgets[i][1]);
+    }
+
+    printf("dialogs %u, failed allocations %u, corrupted blocks %u\n", (unsigned)DIALOGS, (unsigned)fails, (unsigned)bad);
+    printf("largest free block in fast region at least %u%% of its free memory\n", (unsigned)(min_ratio * 100));
+    for (i = 0; gui_mem_getpoolinfo(i, &pool_info); i++) {
+        printf("pool %3u B: blocks %3u, max used %3u, fallbacks %u\n", (unsigned)pool_info.block_size,
+            (unsigned)pool_info.blocks, (unsigned)pool_info.max_used, (unsigned)pool_info.fallbacks);
+        if (pool_info.fallbacks || pool_info.used) {
+            bad++;
+        }
+    }
+    gui_mem_getregioninfo(fast_index, &fast_info);
+    if (fast_info.size - fast_info.free > pools_size + 256) {   /* Only pools stay allocated */
+        printf("heap not free after test\n");
+        bad++;
+    }
+    return bad || fails;
+}
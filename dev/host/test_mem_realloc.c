@@ -0,0 +1,153 @@
+/**
+ * \file            test_mem_realloc.c
+ * \brief           Reallocation in place with first-fit and TLSF allocator
+ *
+ *                  Built twice, with first-fit (`GUI_CFG_MEM_TLSF=0`) and TLSF (`GUI_CFG_MEM_TLSF=1`) allocator,
+ *                  without block pools. Dialog objects are allocated, reallocated and freed at random,
+ *                  texts and graph buffers are reallocated most often.
+ *
+ *                  Content up to smaller size must be kept on each reallocation.
+ *                  Reallocations which kept pointer must match sum of counters from \ref gui_mem_getreallocstats,
+ *                  and free memory must be the same as at start after all objects are freed.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "gui/gui_mem.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define REALLOCS            1000000
+#define OBJECTS             600
+
+static uint8_t heap1[64 * 1024];
+static uint8_t heap2[192 * 1024];
+
+/**
+ * \brief           Allocated object with known content
+ */
+typedef struct {
+    uint8_t* ptr;                                   /*!< Allocated memory */
+    size_t size;                                    /*!< Requested size */
+    uint8_t tag;                                    /*!< Value written to all bytes */
+} object_t;
+
+static object_t objects[OBJECTS];
+static size_t bad, fails;
+
+/**
+ * \brief           Get random size of dialog object
+ */
+static size_t
+random_size(void) {
+    int r = rand() % 100;
+
+    if (r < 50) {
+        return 4 + rand() % 60;                     /* Text */
+    } else if (r < 85) {
+        return 100 + rand() % 150;                  /* Widget handle */
+    }
+    return 300 + rand() % 1200;                     /* Graph data */
+}
+
+/**
+ * \brief           Fill object with random tag
+ */
+static void
+object_fill(object_t* o, size_t size) {
+    o->size = size;
+    o->tag = rand();
+    memset(o->ptr, o->tag, size);
+}
+
+/**
+ * \brief           Check content of object
+ */
+static void
+object_check(const object_t* o, size_t size) {
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        if (o->ptr[i] != o->tag) {
+            bad++;
+            break;
+        }
+    }
+}
+
+int
+main(void) {
+    GUI_MEM_Region_t regions[] = {
+        {heap1, sizeof(heap1)},
+        {heap2, sizeof(heap2)},
+    };
+    gui_mem_realloc_stats_t stats;
+    size_t i, size, kept = 0, reallocs = 0, start_free;
+    uint8_t* ptr;
+    long n;
+
+    if (regions[1].StartAddress < regions[0].StartAddress) {    /* Regions must be in rising address order */
+        regions[0].StartAddress = heap2;
+        regions[0].Size = sizeof(heap2);
+        regions[1].StartAddress = heap1;
+        regions[1].Size = sizeof(heap1);
+    }
+    if (!gui_mem_assignmemory(regions, GUI_COUNT_OF(regions))) {
+        printf("Cannot assign memory\n");
+        return 1;
+    }
+    start_free = gui_mem_getfree();
+
+    srand(4);
+    for (n = 0; n < REALLOCS; ) {
+        object_t* o = &objects[rand() % OBJECTS];
+
+        if (o->ptr == NULL) {                       /* Open new object */
+            size = random_size();
+            if ((o->ptr = gui_mem_alloc(size)) != NULL) {
+                object_fill(o, size);
+            } else {
+                fails++;
+            }
+        } else if (rand() % 8 == 0) {               /* Close object */
+            object_check(o, o->size);
+            gui_mem_free(o->ptr);
+            o->ptr = NULL;
+        } else {                                    /* Change text or data size */
+            size = rand() % 2 ? o->size + rand() % 64 : o->size - rand() % o->size;
+            size = GUI_MIN(GUI_MAX(size, 1), 2000);
+            n++;
+            if ((ptr = gui_mem_realloc(o->ptr, size)) == NULL) {
+                fails++;
+                continue;
+            }
+            kept += ptr == o->ptr;
+            reallocs++;
+            o->ptr = ptr;
+            object_check(o, GUI_MIN(o->size, size));
+            object_fill(o, size);
+        }
+    }
+    for (i = 0; i < OBJECTS; i++) {
+        if (objects[i].ptr != NULL) {
+            object_check(&objects[i], objects[i].size);
+            gui_mem_free(objects[i].ptr);
+        }
+    }
+
+    gui_mem_getreallocstats(&stats);
+    printf("%s: reallocations %u, grown in place %u, shrunk in place %u, moved %u\n", GUI_CFG_MEM_TLSF ? "tlsf" : "first-fit",
+        (unsigned)reallocs, (unsigned)stats.grow_in_place, (unsigned)stats.shrink_in_place, (unsigned)stats.moved);
+    printf("pointer kept %u, failed allocations %u, corrupted blocks %u, free memory %u/%u\n",
+        (unsigned)kept, (unsigned)fails, (unsigned)bad, (unsigned)gui_mem_getfree(), (unsigned)start_free);
+    if (stats.grow_in_place + stats.shrink_in_place != kept || stats.grow_in_place + stats.shrink_in_place + stats.moved != reallocs
+        || stats.grow_in_place == 0 || stats.shrink_in_place == 0) {
+        printf("counters do not match reallocations\n");
+        bad++;
+    }
+    if (gui_mem_getfree() != start_free) {
+        printf("memory not free after test\n");
+        bad++;
+    }
+    return bad || fails;
+}
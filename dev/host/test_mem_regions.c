@@ -0,0 +1,246 @@
+/**
+ * \file            test_mem_regions.c
+ * \brief           Placement of allocation classes to memory regions
+ *
+ *                  Built with first-fit (`GUI_CFG_MEM_TLSF=0`) and TLSF (`GUI_CFG_MEM_TLSF=1`) allocator,
+ *                  and with TLSF allocator and block pools.
+ *                  Heap has fast region not reachable by DMA (CCM), fast region (DTCM) and slow region (SDRAM).
+ *
+ *                  While regions have space, metadata must be in fast regions only,
+ *                  pixel buffers and bulk data in slow region only, also after reallocation.
+ *                  When slow region is full, pixel buffers may use fast region reachable by DMA only,
+ *                  bulk data may use any fast region.
+ *                  Per-region free memory must sum to global free memory.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "gui/gui_mem.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define ROUNDS              100000
+#define OBJECTS             300
+#define PRESSURE_OBJECTS    4000
+
+#define CCM_SIZE            (32 * 1024)
+#define DTCM_SIZE           (64 * 1024)
+#define SDRAM_SIZE          (512 * 1024)
+
+static uint8_t heap[CCM_SIZE + DTCM_SIZE + SDRAM_SIZE];   /* Split to regions in rising address order */
+
+/**
+ * \brief           Memory region of block
+ */
+typedef enum {
+    REGION_CCM = 0x00,                              /*!< Fast region, not reachable by DMA */
+    REGION_DTCM,                                    /*!< Fast region */
+    REGION_SDRAM,                                   /*!< Slow region */
+} region_t;
+
+/**
+ * \brief           Allocated object with known content
+ */
+typedef struct {
+    uint8_t* ptr;                                   /*!< Allocated memory */
+    size_t size;                                    /*!< Requested size */
+    gui_mem_class_t cls;                            /*!< Allocation class */
+    uint8_t tag;                                    /*!< Value written to all bytes */
+} object_t;
+
+static object_t objects[OBJECTS];
+static object_t pressure[PRESSURE_OBJECTS];
+static size_t bad, fails, misplaced, count[3][3];   /* Number of allocations for each class and region */
+
+/**
+ * \brief           Get region of memory block
+ */
+static region_t
+get_region(const uint8_t* ptr) {
+    if (ptr < heap + CCM_SIZE) {
+        return REGION_CCM;
+    } else if (ptr < heap + CCM_SIZE + DTCM_SIZE) {
+        return REGION_DTCM;
+    }
+    return REGION_SDRAM;
+}
+
+/**
+ * \brief           Check object is in region allowed for its class
+ * \param[in]       o: Object to check
+ * \param[in]       full: Set to `1` when slow region may be full
+ */
+static void
+check_region(const object_t* o, uint8_t full) {
+    region_t r = get_region(o->ptr);
+
+    count[o->cls][r]++;
+    if (o->cls == GUI_MEM_CLASS_PIXEL && r == REGION_CCM) {
+        misplaced++;                                /* Never allowed */
+    } else if (!full && (o->cls == GUI_MEM_CLASS_META) != (r != REGION_SDRAM)) {
+        misplaced++;
+    }
+}
+
+/**
+ * \brief           Allocate object of class and fill it with random tag
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+object_alloc(object_t* o, gui_mem_class_t cls, size_t size) {
+    size_t i;
+
+    o->cls = cls;
+    o->size = size;
+    o->tag = rand();
+    if ((o->ptr = gui_mem_calloc_class(size, 1, cls)) == NULL) {
+        return 0;
+    }
+    for (i = 0; i < size; i++) {
+        if (o->ptr[i]) {                            /* Memory must be cleared */
+            bad++;
+            break;
+        }
+    }
+    memset(o->ptr, o->tag, size);
+    return 1;
+}
+
+/**
+ * \brief           Check content and free object
+ */
+static void
+object_free(object_t* o) {
+    size_t i;
+
+    for (i = 0; i < o->size; i++) {
+        if (o->ptr[i] != o->tag) {
+            bad++;
+            break;
+        }
+    }
+    gui_mem_free(o->ptr);
+    o->ptr = NULL;
+}
+
+/**
+ * \brief           Check per-region free memory sums to global free memory
+ */
+static void
+check_free(void) {
+    gui_mem_region_info_t info;
+    size_t i, sum = 0;
+
+    for (i = 0; gui_mem_getregioninfo(i, &info); i++) {
+        sum += info.free;
+    }
+    if (sum != gui_mem_getfree()) {
+        printf("region free %u, global free %u\n", (unsigned)sum, (unsigned)gui_mem_getfree());
+        bad++;
+    }
+}
+
+int
+main(void) {
+    GUI_MEM_Region_t regions[] = {
+        {heap, CCM_SIZE, GUI_MEM_REGION_FAST | GUI_MEM_REGION_NO_DMA},
+        {heap + CCM_SIZE, DTCM_SIZE, GUI_MEM_REGION_FAST},
+        {heap + CCM_SIZE + DTCM_SIZE, SDRAM_SIZE, 0},
+    };
+    static const char* names[] = {"meta", "pixel", "bulk"};
+    gui_mem_region_info_t info;
+    size_t i, size, start_free[GUI_COUNT_OF(regions)], pressure_pixel = 0, pressure_bulk = 0;
+    gui_mem_class_t cls;
+    uint8_t* ptr;
+    long n;
+
+    if (!gui_mem_assignmemory(regions, GUI_COUNT_OF(regions))) {
+        printf("Cannot assign memory\n");
+        return 1;
+    }
+    for (i = 0; gui_mem_getregioninfo(i, &info); i++) {
+        start_free[i] = info.free;                  /* Block pools stay reserved */
+    }
+
+    /* Mixed classes with reallocation, all regions have free space */
+    srand(6);
+    for (n = 0; n < ROUNDS; n++) {
+        object_t* o = &objects[rand() % OBJECTS];
+
+        if (o->ptr == NULL) {
+            cls = (gui_mem_class_t)(rand() % 3);
+            size = cls == GUI_MEM_CLASS_META ? 16 + rand() % 240
+                : cls == GUI_MEM_CLASS_PIXEL ? 512 + rand() % 3584 : 8 + rand() % 1000;
+            if (object_alloc(o, cls, size)) {
+                check_region(o, 0);
+            } else {
+                fails++;
+            }
+        } else if (o->cls != GUI_MEM_CLASS_PIXEL && rand() % 4 == 0) {
+            size = 1 + rand() % (o->cls == GUI_MEM_CLASS_META ? 256 : 1000);
+            if ((ptr = gui_mem_realloc(o->ptr, size)) == NULL) {
+                fails++;
+                continue;
+            }
+            o->ptr = ptr;
+            for (i = 0; i < GUI_MIN(o->size, size); i++) {
+                if (o->ptr[i] != o->tag) {          /* Content must be kept */
+                    bad++;
+                    break;
+                }
+            }
+            memset(o->ptr, o->tag, size);
+            o->size = size;
+            check_region(o, 0);
+        } else {
+            object_free(o);
+        }
+        if ((n % 1000) == 0) {
+            check_free();
+        }
+    }
+    for (i = 0; i < OBJECTS; i++) {
+        if (objects[i].ptr != NULL) {
+            object_free(&objects[i]);
+        }
+    }
+    printf("%s%s: rounds %u, failed allocations %u, misplaced %u\n", GUI_CFG_MEM_TLSF ? "tlsf" : "first-fit",
+        GUI_CFG_USE_MEM_POOLS ? " with pools" : "", (unsigned)ROUNDS, (unsigned)fails, (unsigned)misplaced);
+
+    /* Fill memory with pixel buffers, then with bulk data */
+    for (i = 0; i < PRESSURE_OBJECTS / 2 && object_alloc(&pressure[i], GUI_MEM_CLASS_PIXEL, 4096); i++) {
+        check_region(&pressure[i], 1);
+        pressure_pixel += get_region(pressure[i].ptr) != REGION_SDRAM;
+    }
+    for (; i < PRESSURE_OBJECTS && object_alloc(&pressure[i], GUI_MEM_CLASS_BULK, 1024); i++) {
+        check_region(&pressure[i], 1);
+        pressure_bulk += get_region(pressure[i].ptr) != REGION_SDRAM;
+    }
+    gui_mem_getregioninfo(REGION_CCM, &info);
+    printf("full heap: pixel buffers in DTCM %u, bulk blocks in fast regions %u, CCM %u/%u bytes free\n",
+        (unsigned)pressure_pixel, (unsigned)pressure_bulk, (unsigned)info.free, (unsigned)info.size);
+    if (pressure_pixel == 0 || pressure_bulk == 0 || info.free > 2048) {
+        printf("regions were not used in fallback order\n");
+        bad++;
+    }
+    check_free();
+    for (i = 0; i < PRESSURE_OBJECTS; i++) {
+        if (pressure[i].ptr != NULL) {
+            object_free(&pressure[i]);
+        }
+    }
+
+    for (i = 0; i < 3; i++) {
+        printf("%6s: CCM %6u, DTCM %6u, SDRAM %6u\n", names[i],
+            (unsigned)count[i][REGION_CCM], (unsigned)count[i][REGION_DTCM], (unsigned)count[i][REGION_SDRAM]);
+    }
+    for (i = 0; gui_mem_getregioninfo(i, &info); i++) {
+        if (info.free != start_free[i]) {
+            printf("region %u not free after test\n", (unsigned)i);
+            bad++;
+        }
+    }
+    check_free();
+    printf("corrupted blocks %u\n", (unsigned)bad);
+    return bad || fails || misplaced;
+}
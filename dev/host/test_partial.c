@@ -0,0 +1,79 @@
+/**	
+ * \file            test_partial.c
+ * \brief           Rendering to partial buffer in bands
+ *
+ *                  Library is built with \ref GUI_CFG_USE_PARTIAL_BUFFER enabled,
+ *                  partial buffer holds only few lines and is flushed to screen frame buffer.
+ *                  Test checks that every pixel of each invalidated region reaches the screen.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "widget/gui_widget.h"
+#include "widget/gui_window.h"
+#include "widget/gui_container.h"
+#include "host.h"
+#include "stdio.h"
+
+#define CONT_X              13
+#define CONT_Y              7
+#define CONT_W              201
+#define CONT_H              101
+
+/**
+ * \brief           Check screen has container color inside container and desktop color elsewhere
+ * \param[in]       cont: Set to `1` when container is on screen
+ * \return          Number of wrong pixels
+ */
+static size_t
+check_screen(uint8_t cont) {
+    uint32_t* screen = host_getframe(0);
+    size_t x, y, errors = 0;
+    uint32_t expected;
+    
+    for (y = 0; y < HOST_LCD_HEIGHT; y++) {
+        for (x = 0; x < HOST_LCD_WIDTH; x++) {
+            expected = GUI_COLOR_WIN_LIGHTGRAY;
+            if (cont && x >= CONT_X && x < CONT_X + CONT_W && y >= CONT_Y && y < CONT_Y + CONT_H) {
+                expected = GUI_COLOR_RED;
+            }
+            if (screen[y * HOST_LCD_WIDTH + x] != expected) {
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+int
+main(void) {
+    gui_handle_p h;
+    size_t errors;
+    
+    if (gui_init() != guiOK) {
+        printf("gui_init failed\n");
+        return 1;
+    }
+    
+    gui_process();                                  /* Draw desktop */
+    if ((errors = check_screen(0)) != 0) {
+        printf("desktop: %u wrong pixels\n", (unsigned)errors);
+        return 1;
+    }
+    
+    h = gui_container_create(0, CONT_X, CONT_Y, CONT_W, CONT_H, gui_window_getdesktop(), NULL, 0);
+    gui_container_setcolor(h, GUI_CONTAINER_COLOR_BG, GUI_COLOR_RED);
+    gui_process();
+    if ((errors = check_screen(1)) != 0) {
+        printf("container: %u wrong pixels\n", (unsigned)errors);
+        return 1;
+    }
+    
+    gui_widget_remove(&h);
+    gui_process();
+    if ((errors = check_screen(0)) != 0) {
+        printf("remove: %u wrong pixels\n", (unsigned)errors);
+        return 1;
+    }
+    printf("partial buffer of %u lines: OK\n", (unsigned)HOST_PARTIAL_LINES);
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * \file            test_scratch.c
+ * \brief           Scratch memory for virtual layers of transparent widgets
+ *
+ *                  Two nested transparent containers are redrawn on each frame.
+ *                  Built with scratch memory allocated on first use (`GUI_CFG_TRANSPARENCY_BUFFER_SIZE=0`)
+ *                  and sized in \ref gui_init. Memory functions are wrapped by linker to count heap operations.
+ *
+ *                  Heap may be used in a frame only to enlarge scratch memory, once per grow.
+ *                  After scratch memory is large enough, frames must not use heap at all
+ *                  and both layers must be blended without fallback.
+ */
+#define GUI_INTERNAL
+#include "gui/gui.h"
+#include "gui/gui_mem.h"
+#include "widget/gui_widget.h"
+#include "widget/gui_window.h"
+#include "widget/gui_container.h"
+#include "host.h"
+#include "stdio.h"
+
+#define FRAMES              200
+
+void*   __real_gui_mem_alloc(uint32_t size);
+void*   __real_gui_mem_realloc(void* ptr, size_t size);
+void*   __real_gui_mem_calloc(size_t num, size_t size);
+void*   __real_gui_mem_calloc_class(size_t num, size_t size, gui_mem_class_t cls);
+void    __real_gui_mem_free(void* ptr);
+
+static size_t heap_ops;                             /* Number of heap operations */
+
+void*
+__wrap_gui_mem_alloc(uint32_t size) {
+    heap_ops++;
+    return __real_gui_mem_alloc(size);
+}
+
+void*
+__wrap_gui_mem_realloc(void* ptr, size_t size) {
+    heap_ops++;
+    return __real_gui_mem_realloc(ptr, size);
+}
+
+void*
+__wrap_gui_mem_calloc(size_t num, size_t size) {
+    heap_ops++;
+    return __real_gui_mem_calloc(num, size);
+}
+
+void*
+__wrap_gui_mem_calloc_class(size_t num, size_t size, gui_mem_class_t cls) {
+    heap_ops++;
+    return __real_gui_mem_calloc_class(num, size, cls);
+}
+
+void
+__wrap_gui_mem_free(void* ptr) {
+    heap_ops += ptr != NULL;
+    __real_gui_mem_free(ptr);
+}
+
+int
+main(void) {
+    gui_handle_p outer, inner;
+    gui_scratch_stats_t stats, prev;
+    uint32_t pixel;
+    size_t frame, ops, bad = 0, grow_frames = 0, heap_frames = 0, steady = 0, free_start = 0;
+
+    if (gui_init() != guiOK) {
+        printf("gui_init failed\n");
+        return 1;
+    }
+    gui_getscratchstats(&stats);
+    printf("scratch memory after init %u bytes, grows %u\n", (unsigned)stats.size, (unsigned)stats.grows);
+    if ((GUI_CFG_TRANSPARENCY_BUFFER_SIZE == 0) != (stats.size == 0)) {
+        printf("scratch memory not sized at init\n");
+        bad++;
+    }
+
+    outer = gui_container_create(0, 20, 20, 160, 100, gui_window_getdesktop(), NULL, 0);
+    gui_container_setcolor(outer, GUI_CONTAINER_COLOR_BG, GUI_COLOR_RED);
+    gui_widget_settransparency(outer, 0x80);
+    inner = gui_container_create(0, 30, 30, 100, 50, outer, NULL, 0);
+    gui_container_setcolor(inner, GUI_CONTAINER_COLOR_BG, GUI_COLOR_BLUE);
+    gui_widget_settransparency(inner, 0x80);
+    gui_process();                                  /* Draw created widgets */
+
+    for (frame = 0; frame < FRAMES; frame++) {
+        gui_widget_invalidate(outer);
+        gui_getscratchstats(&prev);
+        heap_ops = 0;
+        gui_process();
+        ops = heap_ops;
+        gui_getscratchstats(&stats);
+
+        /* Heap is used only to allocate new scratch memory and free old one, if any */
+        if (ops != 2 * (stats.grows - prev.grows) - (prev.size == 0 && stats.grows != prev.grows)) {
+            printf("frame %u: %u heap operations, %u grows\n", (unsigned)frame, (unsigned)ops, (unsigned)(stats.grows - prev.grows));
+            bad++;
+        }
+        grow_frames += stats.grows != prev.grows;
+        heap_frames += ops != 0;
+        if (stats.grows == prev.grows && stats.fallbacks == prev.fallbacks) {
+            if (!steady++) {
+                free_start = gui_mem_getfree();
+            }
+        } else if (steady) {                        /* Grow or fallback after scratch was large enough */
+            printf("frame %u: grow or fallback after %u steady frames\n", (unsigned)frame, (unsigned)steady);
+            bad++;
+        }
+        if (stats.used != 0) {
+            printf("frame %u: %u bytes of scratch memory not released\n", (unsigned)frame, (unsigned)stats.used);
+            bad++;
+        }
+    }
+
+    /* Inner container is blended over outer one, which is blended over desktop */
+    pixel = host_getframe(0)[(20 + 30 + 25) * HOST_LCD_WIDTH + 20 + 30 + 50];
+    if ((pixel & 0xFFFFFF) == (GUI_COLOR_BLUE & 0xFFFFFF) || (pixel & 0xFFFFFF) == (GUI_COLOR_RED & 0xFFFFFF)) {
+        printf("containers are not transparent, pixel 0x%08X\n", (unsigned)pixel);
+        bad++;
+    }
+
+    printf("scratch memory %u bytes, peak %u, grows %u, fallbacks %u\n", (unsigned)stats.size,
+        (unsigned)stats.peak, (unsigned)stats.grows, (unsigned)stats.fallbacks);
+    printf("frames %u, frames with grow %u, frames with heap operations %u, steady frames %u, free memory %u/%u\n",
+        (unsigned)FRAMES, (unsigned)grow_frames, (unsigned)heap_frames, (unsigned)steady,
+        (unsigned)gui_mem_getfree(), (unsigned)free_start);
+    if (steady < FRAMES - 2 || gui_mem_getfree() != free_start || stats.peak > stats.size
+        || (GUI_CFG_TRANSPARENCY_BUFFER_SIZE && (stats.grows != 1 || stats.fallbacks))) {
+        bad++;
+    }
+    return bad != 0;
+}
@@ -0,0 +1,1725 @@
+/* Arial_Narrow_Italic_21_AA, characters 0x0020 to 0x007e with 4 bits per pixel, converted with font_conv */
+#include "gui/gui.h"
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0020[4] = {
+    0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0021[48] = {
+    0x00, 0x50, 0x0F,
+    0x00, 0x50, 0x0F,
+    0x00, 0xF0, 0xAA,
+    0x00, 0x55, 0x0A,
+    0x00, 0x55, 0x0A,
+    0x00, 0xF5, 0x00,
+    0x00, 0xA5, 0x0A,
+    0x00, 0xA5, 0x00,
+    0x00, 0xAF, 0x00,
+    0x00, 0x0F, 0x00,
+    0x50, 0xA0, 0x00,
+    0x50, 0x0A, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00,
+    0xF5, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0022[18] = {
+    0x50, 0xAA, 0xAF,
+    0xF0, 0x5A, 0xA5,
+    0xF0, 0x5A, 0x0F,
+    0xF0, 0x5A, 0xAA,
+    0xF0, 0x50, 0x0A,
+    0x05, 0x5A, 0x0A,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0023[96] = {
+    0x00, 0x00, 0x0F, 0x00, 0xAF, 0x00,
+    0x00, 0x50, 0x05, 0x00, 0x0F, 0x00,
+    0x00, 0x50, 0xAA, 0x50, 0xA0, 0x00,
+    0x00, 0x50, 0x0A, 0x50, 0xAA, 0x00,
+    0x00, 0x50, 0x0A, 0x50, 0x0A, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x05, 0x0A, 0xF0, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x05, 0x0A, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xAF, 0x00, 0xA5, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0xAF, 0x00, 0x00,
+    0x50, 0xA0, 0x50, 0x05, 0x00, 0x00,
+    0x50, 0xAA, 0x50, 0xA0, 0x00, 0x00,
+    0x50, 0x0A, 0x50, 0xAA, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0024[95] = {
+    0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0xFF, 0xAF, 0x0A,
+    0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x00, 0xF5, 0x50, 0xF0, 0xAF,
+    0x00, 0xAF, 0x50, 0x0A, 0xAF,
+    0x00, 0xAF, 0x50, 0x0A, 0x00,
+    0x00, 0xAF, 0x5A, 0x00, 0x00,
+    0x00, 0xF5, 0x5F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xAF, 0x0A,
+    0x00, 0x00, 0x05, 0x55, 0x0A,
+    0x00, 0x00, 0xA5, 0x50, 0xAA,
+    0xF5, 0x00, 0x05, 0x50, 0xAA,
+    0x55, 0x0A, 0x0F, 0xF0, 0xAA,
+    0xF0, 0x5F, 0xA0, 0xF5, 0x0A,
+    0x50, 0xF5, 0xFF, 0xAF, 0x0A,
+    0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x50, 0x0A, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0025[128] = {
+    0x00, 0xFF, 0x0F, 0x00, 0x00, 0x50, 0x05, 0x00,
+    0xF0, 0xFF, 0xAF, 0x0A, 0x00, 0xF0, 0x0A, 0x00,
+    0xF5, 0x0A, 0xF5, 0x00, 0x00, 0xA5, 0x00, 0x00,
+    0xA5, 0x0A, 0xF5, 0x00, 0x50, 0xAA, 0x00, 0x00,
+    0xA5, 0x0A, 0xA5, 0x0A, 0xF0, 0x0A, 0x00, 0x00,
+    0xA5, 0x5A, 0xA5, 0x0A, 0xA5, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0x0F, 0x50, 0xAA, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA5, 0x00, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x50, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x00, 0x55, 0x0A, 0xF5, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0xF5, 0x00, 0x55, 0x00,
+    0x00, 0x50, 0xAA, 0x00, 0xA5, 0x0A, 0xF5, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0xF5, 0x50, 0xA5, 0x0A,
+    0x00, 0xAF, 0x00, 0x00, 0xF5, 0xFF, 0xAF, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0026[96] = {
+    0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x55, 0xAA, 0x55, 0x0A, 0x00,
+    0x00, 0x55, 0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x0A, 0x55, 0x0A, 0x00,
+    0x00, 0xF0, 0x5A, 0xA5, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x55, 0x0A, 0x05, 0x0A,
+    0xAF, 0x0A, 0x50, 0x0F, 0xAF, 0x0A,
+    0xAF, 0x00, 0x00, 0xFF, 0xAF, 0x00,
+    0xAF, 0x0A, 0x00, 0xF5, 0xAA, 0x00,
+    0xF5, 0x0A, 0x50, 0xFF, 0xAF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xAA, 0xAF, 0x0A,
+    0x00, 0xFF, 0xAF, 0x0A, 0x05, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0027[12] = {
+    0x50, 0xAA,
+    0xF0, 0x0A,
+    0xF0, 0x0A,
+    0xF0, 0x0A,
+    0xF0, 0x00,
+    0x05, 0x0A,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0028[60] = {
+    0x00, 0x00, 0xA5,
+    0x00, 0x50, 0x0A,
+    0x00, 0x55, 0x00,
+    0x00, 0xA5, 0x00,
+    0x50, 0x05, 0x00,
+    0x50, 0xAA, 0x00,
+    0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00,
+    0xA5, 0x0A, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+    0xA5, 0x00, 0x00,
+    0xA5, 0x0A, 0x00,
+    0x55, 0x00, 0x00,
+    0xF0, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0029[80] = {
+    0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0x55, 0x00,
+    0x00, 0x00, 0x55, 0x00,
+    0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x55, 0x00,
+    0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+    0x50, 0x0A, 0x00, 0x00,
+    0x05, 0x0A, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_002a[28] = {
+    0x00, 0xA5, 0x0A, 0x00,
+    0xA0, 0xA5, 0xAA, 0x0A,
+    0x55, 0xFF, 0xA5, 0x0A,
+    0x50, 0xF5, 0x0F, 0x00,
+    0x00, 0xFF, 0x0A, 0x00,
+    0x50, 0xFA, 0x05, 0x00,
+    0x50, 0x00, 0x05, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_002b[50] = {
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_002c[10] = {
+    0x55, 0x0A,
+    0xF5, 0x0A,
+    0x50, 0x00,
+    0x05, 0x00,
+    0xAA, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_002d[6] = {
+    0xF5, 0xFF, 0xAF,
+    0xF5, 0xFF, 0x0F,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_002e[4] = {
+    0x55, 0x0A,
+    0xF5, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_002f[80] = {
+    0x00, 0x00, 0x00, 0x50, 0x0A,
+    0x00, 0x00, 0x00, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0xA5, 0x00, 0x00,
+    0x00, 0x50, 0x05, 0x00, 0x00,
+    0x00, 0x50, 0x0A, 0x00, 0x00,
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x00,
+    0x50, 0x0A, 0x00, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0030[80] = {
+    0x00, 0x00, 0x55, 0xAF, 0x0A,
+    0x00, 0x50, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0xAA, 0x50, 0xAF,
+    0x00, 0xF5, 0x00, 0x00, 0xAF,
+    0x50, 0xA5, 0x00, 0x00, 0xAF,
+    0x50, 0x0F, 0x00, 0x00, 0xAF,
+    0x50, 0xAA, 0x00, 0x00, 0xAF,
+    0xF0, 0xAA, 0x00, 0x50, 0xA5,
+    0xF0, 0x0A, 0x00, 0x50, 0xA5,
+    0x55, 0x0A, 0x00, 0x50, 0x0F,
+    0x55, 0x0A, 0x00, 0x50, 0xAA,
+    0x55, 0x0A, 0x00, 0x55, 0x0A,
+    0xF0, 0x0A, 0x00, 0xF5, 0x00,
+    0x50, 0x0F, 0x50, 0xA5, 0x00,
+    0x50, 0xF5, 0xFF, 0x0F, 0x00,
+    0x00, 0x55, 0xAF, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0031[64] = {
+    0x00, 0x00, 0xA0, 0x0A,
+    0x00, 0x00, 0xAF, 0x0A,
+    0x00, 0xF0, 0xAF, 0x00,
+    0x50, 0xF5, 0xAF, 0x00,
+    0xF5, 0xFA, 0xA5, 0x00,
+    0x05, 0x50, 0x05, 0x00,
+    0x00, 0x50, 0x0F, 0x00,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x0A, 0x00,
+    0x00, 0x55, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0032[80] = {
+    0x00, 0x00, 0xFF, 0x0F, 0x0A,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0xF5, 0x0A, 0xF0, 0x0F,
+    0x00, 0xAF, 0x0A, 0x50, 0xA5,
+    0x50, 0xA5, 0x00, 0x50, 0xA5,
+    0x00, 0x00, 0x00, 0x50, 0xA5,
+    0x00, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0x00, 0x00, 0xF5, 0x0A,
+    0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x00, 0x55, 0x0A, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x50, 0xA5, 0x0A, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0033[80] = {
+    0x00, 0x00, 0xFF, 0xAF, 0x0A,
+    0x00, 0xF0, 0xFF, 0xFF, 0xAA,
+    0x00, 0xF5, 0x00, 0xF0, 0x0F,
+    0x00, 0xAF, 0x0A, 0x50, 0xA5,
+    0x00, 0x00, 0x00, 0x50, 0xA5,
+    0x00, 0x00, 0x00, 0xF0, 0x0F,
+    0x00, 0x00, 0x55, 0xFF, 0x0A,
+    0x00, 0x00, 0xF5, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0x00, 0x00, 0x50, 0x0A,
+    0xF5, 0x00, 0x00, 0xF0, 0x0A,
+    0x55, 0x0A, 0x00, 0x55, 0x0A,
+    0xF0, 0x0F, 0x50, 0xF5, 0x00,
+    0x50, 0xF5, 0xFF, 0xAF, 0x00,
+    0x00, 0x55, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0034[80] = {
+    0x00, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0x0A,
+    0x00, 0x00, 0x50, 0xFF, 0x0A,
+    0x00, 0x00, 0xF5, 0x55, 0x0A,
+    0x00, 0x50, 0xA5, 0xF5, 0x00,
+    0x00, 0xF0, 0x0A, 0xA5, 0x0A,
+    0x00, 0xA5, 0x0A, 0xA5, 0x0A,
+    0x50, 0x05, 0x00, 0xAF, 0x00,
+    0xF0, 0x0A, 0x00, 0xAF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x00, 0xF0, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0035[80] = {
+    0x00, 0x50, 0xFF, 0xFF, 0xAF,
+    0x00, 0x50, 0xFF, 0xFF, 0xAF,
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xA5, 0x5F, 0x0F, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x50, 0xA5, 0x0A, 0x55, 0x0F,
+    0x00, 0x00, 0x00, 0x50, 0x0F,
+    0x00, 0x00, 0x00, 0x50, 0x05,
+    0x00, 0x00, 0x00, 0x50, 0x05,
+    0x55, 0x0A, 0x00, 0x50, 0x0F,
+    0xF0, 0x0A, 0x00, 0x55, 0xAA,
+    0xF0, 0x0F, 0x00, 0xFF, 0x0A,
+    0x50, 0xF5, 0xFF, 0xAF, 0x00,
+    0x00, 0x55, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0036[80] = {
+    0x00, 0x00, 0xFF, 0x0F, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x55, 0x0A,
+    0x50, 0xAF, 0x00, 0x50, 0xAA,
+    0xF0, 0xAA, 0x00, 0x00, 0x00,
+    0xF0, 0x5A, 0xF5, 0x00, 0x00,
+    0x55, 0x5F, 0xFF, 0xAF, 0x00,
+    0xF5, 0x0F, 0x50, 0xA5, 0x0A,
+    0xF5, 0x0A, 0x00, 0xF5, 0x00,
+    0xA5, 0x0A, 0x00, 0x55, 0x00,
+    0xA5, 0x0A, 0x00, 0x55, 0x00,
+    0xA5, 0x0A, 0x00, 0xF5, 0x00,
+    0xA5, 0x0A, 0x00, 0xAF, 0x0A,
+    0xF5, 0xAA, 0xF0, 0xAF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xFF, 0x0F, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0037[80] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x0A,
+    0x00, 0x00, 0x50, 0x05, 0x00,
+    0x00, 0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x00, 0xA5, 0x00, 0x00,
+    0x00, 0x50, 0x05, 0x00, 0x00,
+    0x00, 0x50, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0038[80] = {
+    0x00, 0x00, 0xFF, 0xAF, 0x0A,
+    0x00, 0xF0, 0xFF, 0xFF, 0xAA,
+    0x00, 0xF5, 0x0A, 0x50, 0xAF,
+    0x00, 0xA5, 0x0A, 0x00, 0xAF,
+    0x00, 0xA5, 0x0A, 0x50, 0xA5,
+    0x00, 0xF5, 0x00, 0xF0, 0x0F,
+    0x00, 0xF0, 0xFF, 0xFF, 0x00,
+    0x00, 0xF5, 0xFF, 0xAF, 0x0A,
+    0x50, 0xAF, 0x0A, 0x55, 0x0A,
+    0xF0, 0xAA, 0x00, 0x50, 0xAA,
+    0x55, 0x0A, 0x00, 0x50, 0xAA,
+    0x55, 0x0A, 0x00, 0xF0, 0xAA,
+    0x55, 0x0A, 0x00, 0x55, 0x0A,
+    0xF0, 0x0F, 0x00, 0xFF, 0x00,
+    0x50, 0xF5, 0xFF, 0xAF, 0x00,
+    0x00, 0x55, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0039[80] = {
+    0x00, 0x00, 0xFF, 0x0F, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0xF5, 0x0A, 0xF0, 0x0F,
+    0x50, 0xA5, 0x00, 0x50, 0xA5,
+    0x50, 0x0F, 0x00, 0x00, 0xAF,
+    0x50, 0xAA, 0x00, 0x00, 0xAF,
+    0x50, 0xAA, 0x00, 0x50, 0xA5,
+    0x50, 0x0F, 0x00, 0x50, 0xAF,
+    0x50, 0xA5, 0x0A, 0xF5, 0xAF,
+    0x00, 0xF5, 0xFF, 0x5F, 0x0F,
+    0x00, 0xF0, 0xAF, 0xFA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0x0A,
+    0x55, 0x0A, 0x00, 0xFF, 0x00,
+    0xF0, 0xAA, 0x50, 0xAF, 0x00,
+    0x50, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xF5, 0xAF, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_003a[33] = {
+    0x00, 0xA5, 0x0A,
+    0x00, 0xAF, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_003b[42] = {
+    0x00, 0xA5, 0x0A,
+    0x00, 0xAF, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00,
+    0x00, 0x0A, 0x00,
+    0x05, 0x00, 0x00,
+    0xAA, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_003c[55] = {
+    0x00, 0x00, 0x00, 0x00, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xAF, 0x0A,
+    0x00, 0x55, 0xAF, 0x0A, 0x00,
+    0x55, 0xAF, 0x0A, 0x00, 0x00,
+    0xF5, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0xAF, 0x0A, 0x00, 0x00,
+    0x00, 0xFF, 0xAF, 0x0A, 0x00,
+    0x00, 0x00, 0xFF, 0xAF, 0x0A,
+    0x00, 0x00, 0x00, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0xAA,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_003d[35] = {
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_003e[55] = {
+    0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x0F, 0x00, 0x00, 0x00,
+    0x50, 0xF5, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xF5, 0x0F, 0x00,
+    0x00, 0x00, 0x50, 0xF5, 0xAA,
+    0x00, 0x00, 0x00, 0xF0, 0xAA,
+    0x00, 0x00, 0x50, 0xF5, 0xAA,
+    0x00, 0x50, 0xF5, 0x0F, 0x00,
+    0x50, 0xF5, 0x0F, 0x00, 0x00,
+    0xF5, 0x0F, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_003f[80] = {
+    0x00, 0xF0, 0xFF, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xAF, 0x0A,
+    0x50, 0x0F, 0x00, 0xF5, 0x0A,
+    0xF0, 0x0A, 0x00, 0xF0, 0x0A,
+    0x55, 0x0A, 0x00, 0xF0, 0x0A,
+    0x00, 0x00, 0x00, 0xF5, 0x0A,
+    0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x00, 0x55, 0xAA, 0x00,
+    0x00, 0x50, 0xA5, 0x0A, 0x00,
+    0x00, 0xF0, 0xAA, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0040[189] = {
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0x0F, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAF, 0x0A, 0x00,
+    0x00, 0x50, 0xFF, 0xA0, 0x00, 0x50, 0xF5, 0xAA, 0x00,
+    0x00, 0x55, 0xAA, 0x00, 0x00, 0x00, 0x50, 0xAF, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x50, 0x0F, 0x00, 0x55, 0xAF, 0x5A, 0xAA, 0x55, 0x0A,
+    0xF0, 0x0A, 0x50, 0xF5, 0xFF, 0xFA, 0x0A, 0x50, 0x0A,
+    0x55, 0x00, 0xF0, 0x0F, 0x50, 0xF5, 0x0A, 0x50, 0x0A,
+    0x05, 0x0A, 0xF5, 0x00, 0x00, 0xF5, 0x00, 0x50, 0x0A,
+    0xA5, 0x0A, 0xAF, 0x0A, 0x00, 0xF5, 0x00, 0x50, 0x0A,
+    0xA5, 0x50, 0xA5, 0x00, 0x00, 0xA5, 0x0A, 0xF0, 0x0A,
+    0xA5, 0x50, 0xA5, 0x00, 0x00, 0xAF, 0x00, 0x55, 0x00,
+    0xA5, 0x5A, 0xA5, 0x00, 0x50, 0xAF, 0x00, 0xAF, 0x0A,
+    0xA5, 0x0A, 0xFF, 0x00, 0x55, 0xAF, 0xF0, 0x0F, 0x00,
+    0x55, 0x00, 0xF5, 0xFF, 0x5F, 0xF5, 0xFF, 0x00, 0x00,
+    0xF0, 0x0A, 0x50, 0xF5, 0x00, 0xFF, 0x0F, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xA0, 0x00, 0x00, 0x5F, 0xAF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0041[96] = {
+    0x00, 0x00, 0x00, 0x50, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xA5, 0x0A,
+    0x00, 0x00, 0x50, 0xA5, 0xA5, 0x0A,
+    0x00, 0x00, 0x50, 0x0F, 0xF5, 0x00,
+    0x00, 0x00, 0xF0, 0xAA, 0xF5, 0x00,
+    0x00, 0x00, 0xF5, 0x0A, 0x55, 0x0A,
+    0x00, 0x00, 0xAF, 0x0A, 0x55, 0x0A,
+    0x00, 0x50, 0xAF, 0x00, 0xF0, 0x0A,
+    0x00, 0xF0, 0xAA, 0x00, 0xF0, 0x0A,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x50, 0xA5, 0x00, 0x00, 0x50, 0x0F,
+    0x50, 0x0F, 0x00, 0x00, 0x50, 0x05,
+    0x55, 0x0A, 0x00, 0x00, 0x50, 0xA5,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0xAF,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0042[96] = {
+    0x00, 0x50, 0xFF, 0xFF, 0x0F, 0x0A,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0xF0, 0x0A, 0x00, 0xF0, 0x0F,
+    0x00, 0x55, 0x0A, 0x00, 0x50, 0x05,
+    0x00, 0xF5, 0x00, 0x00, 0x50, 0x05,
+    0x00, 0xA5, 0x0A, 0x00, 0x50, 0xAA,
+    0x00, 0xAF, 0x0A, 0x00, 0x55, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0xFF, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x55, 0xAA,
+    0x50, 0x0F, 0x00, 0x00, 0x50, 0xAA,
+    0x50, 0xAA, 0x00, 0x00, 0x50, 0xAA,
+    0xF0, 0x0A, 0x00, 0x00, 0xF0, 0xAA,
+    0x55, 0x0A, 0x00, 0x00, 0xFF, 0x0A,
+    0x55, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0043[112] = {
+    0x00, 0x00, 0x55, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF5, 0x0F, 0x00, 0xF0, 0xAF, 0x00,
+    0x50, 0xA5, 0x0A, 0x00, 0x00, 0xAF, 0x0A,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x55, 0x0A, 0x00,
+    0x50, 0xAF, 0x0A, 0x50, 0xA5, 0x0A, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0xF0, 0xF5, 0x0F, 0x0A, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0044[112] = {
+    0x00, 0x50, 0xFF, 0xFF, 0x0F, 0x0A, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00, 0xF0, 0xAF, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0xAF, 0x0A, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0x50, 0xA5, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0xAF, 0x0A,
+    0x50, 0xAA, 0x00, 0x00, 0x50, 0xAF, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x55, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0xF0, 0xF5, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x0F, 0x0A, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0045[112] = {
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0046[96] = {
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0xFF, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0047[112] = {
+    0x00, 0x00, 0xF0, 0xF5, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xF5, 0x0F, 0x00, 0xF0, 0xAF, 0x00,
+    0x50, 0xA5, 0x0A, 0x00, 0x00, 0xA5, 0x0A,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0xFF, 0xFF, 0xAF, 0x0A,
+    0xA5, 0x0A, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x50, 0x0F, 0x00,
+    0x50, 0xAF, 0x0A, 0x00, 0x5F, 0xAA, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF0, 0xF5, 0xFF, 0xA0, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0048[112] = {
+    0x00, 0x50, 0xAA, 0x00, 0x00, 0x50, 0xA5,
+    0x00, 0xF0, 0xAA, 0x00, 0x00, 0x50, 0x0F,
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0xF0, 0xAA,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x50, 0xA5, 0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0xAF, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x50, 0xAF, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x50, 0x0F, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0xF0, 0xAA, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0xF0, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0049[48] = {
+    0x00, 0x50, 0xAA,
+    0x00, 0xF0, 0xAA,
+    0x00, 0xF0, 0x0A,
+    0x00, 0x55, 0x0A,
+    0x00, 0xF5, 0x00,
+    0x00, 0xA5, 0x0A,
+    0x00, 0xAF, 0x0A,
+    0x00, 0xAF, 0x00,
+    0x50, 0xA5, 0x00,
+    0x50, 0x0F, 0x00,
+    0x50, 0x0F, 0x00,
+    0x50, 0xAA, 0x00,
+    0xF0, 0x0A, 0x00,
+    0x55, 0x0A, 0x00,
+    0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_004a[80] = {
+    0x00, 0x00, 0x00, 0x50, 0xA5,
+    0x00, 0x00, 0x00, 0x50, 0x0F,
+    0x00, 0x00, 0x00, 0x50, 0x0F,
+    0x00, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0x00, 0xAF, 0x0A,
+    0x00, 0x00, 0x00, 0xAF, 0x00,
+    0xA5, 0x00, 0x50, 0xA5, 0x00,
+    0xA5, 0x00, 0x50, 0x0F, 0x00,
+    0xF5, 0x00, 0x55, 0xAA, 0x00,
+    0xF5, 0xFF, 0xFF, 0x0A, 0x00,
+    0x50, 0xF5, 0x0F, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_004b[112] = {
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0xFF, 0x0A,
+    0x00, 0x55, 0x0A, 0x00, 0xF0, 0xAF, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0xF5, 0x0A, 0x00,
+    0x00, 0xF5, 0x00, 0x50, 0xAF, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0xF5, 0xAA, 0x00, 0x00,
+    0x00, 0xAF, 0x5A, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x5F, 0x0F, 0x00, 0x00, 0x00,
+    0x50, 0xF5, 0xF5, 0xAF, 0x00, 0x00, 0x00,
+    0x50, 0xF5, 0x0F, 0xAF, 0x0A, 0x00, 0x00,
+    0x50, 0xFF, 0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x55, 0xAA, 0x00, 0x00,
+    0xF0, 0xAA, 0x00, 0x50, 0x0F, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x50, 0xA5, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0xF5, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_004c[80] = {
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00,
+    0x50, 0xA5, 0x00, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x00,
+    0xF0, 0xAA, 0x00, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0A,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_004d[128] = {
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0xAF,
+    0x00, 0x55, 0x0F, 0x00, 0x00, 0x00, 0x55, 0x0F,
+    0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0xF5, 0x0F,
+    0x00, 0xF5, 0xA5, 0x00, 0x00, 0x50, 0x55, 0xAA,
+    0x00, 0xF5, 0xA5, 0x00, 0x00, 0x50, 0x5F, 0x0A,
+    0x00, 0xAF, 0xAF, 0x0A, 0x00, 0x55, 0xFA, 0x0A,
+    0x00, 0xAF, 0xA5, 0x0A, 0x00, 0xA5, 0x5F, 0x0A,
+    0x50, 0xA5, 0x55, 0x00, 0x50, 0xA5, 0xF5, 0x00,
+    0x50, 0x0F, 0x55, 0x00, 0x50, 0xAA, 0xA5, 0x0A,
+    0x50, 0x0F, 0xF0, 0x0A, 0x55, 0x0A, 0xA5, 0x0A,
+    0x50, 0xAA, 0xF0, 0x0A, 0xA5, 0x0A, 0xAF, 0x00,
+    0xF0, 0x0A, 0x50, 0x0A, 0xAF, 0x50, 0xA5, 0x00,
+    0xF0, 0x0A, 0x50, 0x5A, 0x0F, 0x50, 0xA5, 0x00,
+    0x55, 0x0A, 0x50, 0x5F, 0x0A, 0x50, 0x0F, 0x00,
+    0xF5, 0x00, 0x50, 0xFF, 0x00, 0x50, 0xAA, 0x00,
+    0xF5, 0x00, 0x50, 0xA5, 0x00, 0xF0, 0xAA, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_004e[112] = {
+    0x00, 0xF0, 0xAA, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0x55, 0x0F, 0x00, 0x00, 0x50, 0xAA,
+    0x00, 0x55, 0xAF, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0xF5, 0xA5, 0x0A, 0x00, 0x55, 0x0A,
+    0x00, 0xA5, 0x5F, 0x0A, 0x00, 0x55, 0x0A,
+    0x00, 0xAF, 0xFA, 0x0A, 0x00, 0xF5, 0x00,
+    0x00, 0xAF, 0x50, 0x0F, 0x00, 0xA5, 0x0A,
+    0x50, 0xA5, 0x50, 0xA5, 0x00, 0xAF, 0x0A,
+    0x50, 0x05, 0x00, 0xAF, 0x0A, 0xAF, 0x00,
+    0x50, 0x0F, 0x00, 0xF5, 0x50, 0xA5, 0x00,
+    0x50, 0xAA, 0x00, 0x55, 0x5A, 0x05, 0x00,
+    0xF0, 0xAA, 0x00, 0xF0, 0x5A, 0x0F, 0x00,
+    0xF0, 0x0A, 0x00, 0x50, 0x5F, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0x50, 0xF5, 0xAA, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0xF5, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_004f[112] = {
+    0x00, 0x00, 0x55, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF5, 0x0F, 0x00, 0xF0, 0xAF, 0x00,
+    0x50, 0xA5, 0x0A, 0x00, 0x00, 0xAF, 0x0A,
+    0xF0, 0x0F, 0x00, 0x00, 0x00, 0xF5, 0x0A,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0xF5, 0x0A, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x55, 0xAA, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x50, 0xAF, 0x0A, 0x50, 0xF5, 0x0A, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x50, 0xF5, 0xAF, 0x0A, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0050[112] = {
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0xAF, 0x0A,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0xAF, 0x0A,
+    0x00, 0xAF, 0x0A, 0x00, 0xF0, 0xAF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0051[126] = {
+    0x00, 0x00, 0x55, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xF5, 0x0F, 0x00, 0xF0, 0xAF, 0x00,
+    0x50, 0xA5, 0x0A, 0x00, 0x00, 0xAF, 0x0A,
+    0xF0, 0x0F, 0x00, 0x00, 0x00, 0xF5, 0x0A,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0xF5, 0x0A, 0x00, 0xAA, 0x50, 0xA5, 0x00,
+    0x55, 0xAA, 0x00, 0xFF, 0xF0, 0xAA, 0x00,
+    0x50, 0xAF, 0x0A, 0xF0, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0x0A, 0x00,
+    0x00, 0x50, 0xF5, 0xAF, 0x5F, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0052[112] = {
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0x0A,
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0xF5, 0x0A,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0xF5, 0x0A,
+    0x00, 0xAF, 0x0A, 0x00, 0xF0, 0xA5, 0x0A,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x50, 0xF5, 0xFF, 0xFF, 0x0F, 0x0A, 0x00,
+    0x50, 0x0F, 0x00, 0xF0, 0xAA, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x50, 0xA5, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0xAF, 0x0A, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0xF5, 0x0A, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x55, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x50, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0053[96] = {
+    0x00, 0x00, 0x55, 0xFF, 0x0F, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0xAA, 0x00, 0x55, 0xAA,
+    0x00, 0xF5, 0x00, 0x00, 0x50, 0xAF,
+    0x00, 0xA5, 0x0A, 0x00, 0x50, 0xA5,
+    0x00, 0xF5, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xF5, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xF5, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x55, 0x0A,
+    0x55, 0x0A, 0x00, 0x00, 0xF0, 0x0A,
+    0xF0, 0xAA, 0x00, 0x00, 0x55, 0x0A,
+    0x50, 0xAF, 0x0A, 0x50, 0xF5, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0xF0, 0xF5, 0xAF, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0054[96] = {
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xF0, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0055[112] = {
+    0x00, 0xA5, 0x0A, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x50, 0xA5, 0x00, 0x00, 0x00, 0xAF, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0xF0, 0xAA, 0x00, 0x00, 0x50, 0x0F, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0xF0, 0xAA, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x55, 0x0A, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0xF5, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x50, 0xA5, 0x0A, 0x00,
+    0x55, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0056[112] = {
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0xAF, 0x0A,
+    0xF0, 0x0A, 0x00, 0x00, 0x50, 0xA5, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x50, 0x0F, 0x00,
+    0x50, 0xAA, 0x00, 0x00, 0x55, 0x0A, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0xF5, 0x00, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0xAF, 0x0A, 0x00,
+    0x50, 0xA5, 0x00, 0x50, 0xAF, 0x00, 0x00,
+    0x50, 0xA5, 0x00, 0xF0, 0xAA, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x0A, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xA5, 0x5A, 0xA5, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x50, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xF0, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xAF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xAF, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0057[144] = {
+    0x55, 0x0A, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x50, 0xA5,
+    0x55, 0x0A, 0x00, 0x50, 0xF5, 0x00, 0x00, 0x50, 0xAA,
+    0xF0, 0x0A, 0x00, 0x50, 0xFF, 0x00, 0x00, 0x55, 0x0A,
+    0xF0, 0x0A, 0x00, 0xF0, 0xFF, 0x0A, 0x00, 0xF5, 0x00,
+    0xF0, 0x0A, 0x00, 0xF5, 0x55, 0x0A, 0x00, 0xAF, 0x0A,
+    0xF0, 0x0A, 0x00, 0xAF, 0x5F, 0x0A, 0x50, 0xA5, 0x00,
+    0xF0, 0x0A, 0x50, 0xAF, 0xF0, 0x0A, 0x50, 0xAA, 0x00,
+    0xF0, 0x0A, 0x50, 0xAA, 0xF0, 0x0A, 0x55, 0x0A, 0x00,
+    0x50, 0xAA, 0x55, 0x0A, 0xF0, 0x0A, 0xF5, 0x00, 0x00,
+    0x50, 0xAA, 0xF5, 0x00, 0xF0, 0x0A, 0xAF, 0x0A, 0x00,
+    0x50, 0xAA, 0xAF, 0x00, 0xF0, 0x5A, 0xA5, 0x00, 0x00,
+    0x50, 0xFA, 0x0F, 0x00, 0xF0, 0xFA, 0xAA, 0x00, 0x00,
+    0x50, 0xFF, 0xAA, 0x00, 0x50, 0x5F, 0x0A, 0x00, 0x00,
+    0x50, 0xFF, 0x0A, 0x00, 0x50, 0xFF, 0x00, 0x00, 0x00,
+    0x50, 0xAF, 0x0A, 0x00, 0x50, 0xAF, 0x00, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00, 0x50, 0xAF, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0058[128] = {
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0x50, 0xAF, 0x0A,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0x55, 0xAA, 0x00,
+    0x00, 0x50, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x50, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x5A, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x5F, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xAF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xAF, 0x50, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x0A, 0x00, 0xAF, 0x0A, 0x00, 0x00,
+    0x50, 0xA5, 0x0A, 0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x55, 0x0F, 0x00, 0x00, 0x55, 0x0A, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0059[112] = {
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x50, 0x0F, 0x00, 0x00, 0x50, 0xAF, 0x00,
+    0x50, 0xA5, 0x00, 0x00, 0xF0, 0xAA, 0x00,
+    0x00, 0xAF, 0x0A, 0x00, 0xF5, 0x0A, 0x00,
+    0x00, 0xF5, 0x0A, 0x50, 0xA5, 0x0A, 0x00,
+    0x00, 0xF0, 0xAA, 0xF0, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0x0F, 0xF5, 0x0A, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0xAF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA5, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_005a[96] = {
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0x0A,
+    0x00, 0x00, 0x00, 0x50, 0xA5, 0x0A,
+    0x00, 0x00, 0x00, 0xF0, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0x0A, 0x00,
+    0x00, 0x00, 0x50, 0xA5, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_005b[80] = {
+    0x00, 0x00, 0xF5, 0xAF,
+    0x00, 0x00, 0xFF, 0xAF,
+    0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x50, 0x05, 0x00,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0xA5, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+    0x50, 0xA5, 0x00, 0x00,
+    0x50, 0x05, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00,
+    0xF0, 0xFF, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_005c[32] = {
+    0x05, 0x00,
+    0xA5, 0x00,
+    0xA5, 0x00,
+    0x05, 0x00,
+    0x05, 0x00,
+    0xA0, 0x0A,
+    0xA0, 0x0A,
+    0x50, 0x00,
+    0x50, 0x0A,
+    0x50, 0x0A,
+    0x50, 0x00,
+    0x50, 0x00,
+    0x00, 0xAA,
+    0x00, 0xAA,
+    0x00, 0x05,
+    0x00, 0xA5,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_005d[100] = {
+    0x00, 0x00, 0xFF, 0xAF, 0x0A,
+    0x00, 0x50, 0xF5, 0xAF, 0x00,
+    0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x00, 0x50, 0x05, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x00, 0x55, 0x0A, 0x00,
+    0x00, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x50, 0xA5, 0x00, 0x00,
+    0x00, 0x50, 0x05, 0x00, 0x00,
+    0x00, 0x50, 0xAA, 0x00, 0x00,
+    0x00, 0x50, 0xAA, 0x00, 0x00,
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0xAF, 0x0A, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_005e[32] = {
+    0x00, 0x55, 0x0A, 0x00,
+    0x00, 0xF5, 0xAA, 0x00,
+    0x00, 0xFF, 0xA5, 0x00,
+    0x50, 0x05, 0xA5, 0x00,
+    0x50, 0xAA, 0xF5, 0x00,
+    0xF0, 0x0A, 0xF0, 0x0A,
+    0xF5, 0x00, 0x50, 0xAA,
+    0xAF, 0x0A, 0x50, 0x0F,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_005f[12] = {
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0060[6] = {
+    0xF5, 0x0A,
+    0xF0, 0xAA,
+    0x50, 0x05,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0061[55] = {
+    0x00, 0x50, 0xF5, 0xFF, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0x0F,
+    0x50, 0xAF, 0x0A, 0x50, 0xA5,
+    0x00, 0x00, 0x00, 0xF0, 0xAF,
+    0x00, 0x5F, 0xFF, 0xFF, 0x0F,
+    0xF0, 0xFF, 0xFF, 0xF0, 0xAA,
+    0xF5, 0xAA, 0x00, 0xF0, 0x0A,
+    0xA5, 0x0A, 0x00, 0xF5, 0x0A,
+    0xF5, 0x0A, 0x50, 0xF5, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0x00,
+    0x50, 0xF5, 0x0F, 0x55, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0062[80] = {
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0xFA, 0xAF, 0x0A,
+    0x00, 0xFF, 0xF5, 0xFF, 0x0A,
+    0x50, 0xF5, 0x00, 0x55, 0xAA,
+    0x50, 0xAF, 0x00, 0x50, 0x0F,
+    0x50, 0xAA, 0x00, 0x50, 0x0F,
+    0xF0, 0x0A, 0x00, 0x50, 0x0F,
+    0xF0, 0x0A, 0x00, 0xF0, 0xAA,
+    0x55, 0x0A, 0x00, 0x55, 0x0A,
+    0xF5, 0x0F, 0x50, 0xF5, 0x00,
+    0xA5, 0xFF, 0xFF, 0xAF, 0x00,
+    0xA5, 0xF0, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0063[55] = {
+    0x00, 0x00, 0x5F, 0xA0, 0x00,
+    0x00, 0xF5, 0xFF, 0xAF, 0x0A,
+    0x50, 0xAF, 0x0A, 0xF5, 0x0A,
+    0xF0, 0xAA, 0x00, 0xF0, 0x0A,
+    0x55, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0xA5, 0x0A,
+    0xF5, 0x0A, 0x50, 0xAF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xFF, 0xAF, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0064[96] = {
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0xA5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x50, 0xF5, 0x00, 0xAF, 0x00,
+    0x00, 0xFF, 0xFF, 0x5F, 0x05, 0x00,
+    0x50, 0xAF, 0x0A, 0xF5, 0xAA, 0x00,
+    0xF0, 0xAA, 0x00, 0xF0, 0xAA, 0x00,
+    0x55, 0x0A, 0x00, 0xF0, 0x0A, 0x00,
+    0xF5, 0x00, 0x00, 0xF0, 0x0A, 0x00,
+    0xA5, 0x0A, 0x00, 0x55, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0xA5, 0x0A, 0x00,
+    0xF5, 0xAA, 0x50, 0xAF, 0x0A, 0x00,
+    0xF0, 0xFF, 0xFF, 0xA5, 0x00, 0x00,
+    0x00, 0xFF, 0xAA, 0xAF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0065[55] = {
+    0x00, 0x50, 0xF5, 0x0F, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0x0A,
+    0x50, 0xAF, 0x0A, 0xF0, 0xAA,
+    0xF0, 0x0A, 0x00, 0x50, 0x05,
+    0x55, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xA5, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xAA, 0x00, 0x5F, 0x0A,
+    0x50, 0xFF, 0xFF, 0xAF, 0x0A,
+    0x00, 0x55, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0066[64] = {
+    0x00, 0x00, 0xFF, 0xAA,
+    0x00, 0xF0, 0xFF, 0xAA,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x0A, 0x00,
+    0x00, 0xF5, 0x00, 0x00,
+    0xF0, 0xFF, 0xAF, 0x0A,
+    0x55, 0xFF, 0xAF, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+    0x50, 0xA5, 0x00, 0x00,
+    0x50, 0x05, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00,
+    0x50, 0xAA, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0067[75] = {
+    0x00, 0x50, 0xF5, 0x00, 0xAF,
+    0x00, 0xFF, 0xFF, 0xAF, 0xAF,
+    0x50, 0xAF, 0x0A, 0xF5, 0x0F,
+    0xF0, 0xAA, 0x00, 0xF0, 0xAA,
+    0x55, 0x0A, 0x00, 0x50, 0xAA,
+    0xF5, 0x00, 0x00, 0x50, 0x0A,
+    0xA5, 0x0A, 0x00, 0xF0, 0x0A,
+    0xF5, 0x00, 0x00, 0xF5, 0x0A,
+    0x55, 0xAA, 0x50, 0xF5, 0x00,
+    0xF0, 0xFF, 0xFF, 0xA5, 0x0A,
+    0x00, 0xFF, 0xAA, 0xAF, 0x0A,
+    0x00, 0x00, 0x50, 0xA5, 0x00,
+    0xAF, 0x0A, 0xF0, 0x0F, 0x00,
+    0xF5, 0xFF, 0xFF, 0x0A, 0x00,
+    0xF0, 0xF5, 0x0F, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0068[80] = {
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0xF0, 0xFF, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0x0F,
+    0x50, 0xF5, 0xAA, 0x50, 0x05,
+    0x50, 0xAF, 0x00, 0x50, 0x0F,
+    0x50, 0x0F, 0x00, 0x50, 0xAA,
+    0xF0, 0xAA, 0x00, 0xF0, 0x0A,
+    0xF0, 0x0A, 0x00, 0xF0, 0x0A,
+    0x55, 0x0A, 0x00, 0x55, 0x0A,
+    0xF5, 0x00, 0x00, 0xF5, 0x00,
+    0xA5, 0x0A, 0x00, 0xA5, 0x0A,
+    0xA5, 0x0A, 0x00, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0069[48] = {
+    0x00, 0x55, 0x0A,
+    0x00, 0xF5, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x50, 0xA5, 0x00,
+    0x50, 0x05, 0x00,
+    0x50, 0xAA, 0x00,
+    0x50, 0xAA, 0x00,
+    0xF0, 0x0A, 0x00,
+    0xF0, 0x0A, 0x00,
+    0x55, 0x00, 0x00,
+    0xF5, 0x00, 0x00,
+    0xA5, 0x0A, 0x00,
+    0xAF, 0x00, 0x00,
+    0xAF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_006a[80] = {
+    0x00, 0x00, 0x50, 0x05,
+    0x00, 0x00, 0x50, 0x0F,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x50, 0x05, 0x00,
+    0x00, 0x50, 0x0F, 0x00,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x0A, 0x00,
+    0x00, 0xF5, 0x00, 0x00,
+    0xF5, 0xAF, 0x0A, 0x00,
+    0xF5, 0xAA, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_006b[80] = {
+    0x00, 0xF0, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x55, 0xAA,
+    0x00, 0xAF, 0x00, 0xAF, 0x0A,
+    0x50, 0x05, 0xF0, 0x0F, 0x00,
+    0x50, 0x0F, 0xF5, 0x00, 0x00,
+    0x50, 0x5F, 0xAF, 0x00, 0x00,
+    0xF0, 0xFF, 0xA5, 0x0A, 0x00,
+    0xF0, 0x0F, 0xF5, 0x00, 0x00,
+    0x55, 0x0A, 0xF0, 0x0A, 0x00,
+    0xF5, 0x00, 0x50, 0xAA, 0x00,
+    0xA5, 0x0A, 0x50, 0xAF, 0x00,
+    0xA5, 0x0A, 0x00, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_006c[48] = {
+    0xFF, 0xFF, 0x0A,
+    0xFF, 0x5F, 0x0A,
+    0x00, 0xF5, 0x00,
+    0x00, 0xA5, 0x0A,
+    0x00, 0xA5, 0x0A,
+    0x00, 0xAF, 0x00,
+    0x50, 0xA5, 0x00,
+    0x50, 0x05, 0x00,
+    0x50, 0xAA, 0x00,
+    0x50, 0xAA, 0x00,
+    0xF0, 0x0A, 0x00,
+    0xF0, 0x0A, 0x00,
+    0x55, 0x00, 0x00,
+    0xF5, 0x00, 0x00,
+    0xA5, 0x0A, 0x00,
+    0xAF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_006d[88] = {
+    0x00, 0xAF, 0xF0, 0xAF, 0x0A, 0x55, 0xAF, 0x00,
+    0x50, 0xA5, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF, 0x00,
+    0x50, 0xF5, 0x0A, 0xF0, 0xAF, 0x0A, 0xF5, 0x00,
+    0x50, 0xAF, 0x00, 0xF0, 0x0F, 0x00, 0xA5, 0x0A,
+    0x50, 0x0F, 0x00, 0x55, 0x0A, 0x00, 0xA5, 0x0A,
+    0xF0, 0xAA, 0x00, 0xF5, 0x0A, 0x00, 0xAF, 0x00,
+    0xF0, 0x0A, 0x00, 0xF5, 0x00, 0x50, 0xA5, 0x00,
+    0x55, 0x0A, 0x00, 0xAF, 0x0A, 0x50, 0x0F, 0x00,
+    0xF5, 0x00, 0x00, 0xAF, 0x00, 0x50, 0xAA, 0x00,
+    0xA5, 0x0A, 0x50, 0xA5, 0x00, 0x50, 0xAA, 0x00,
+    0xAF, 0x00, 0x50, 0x0F, 0x00, 0xF0, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_006e[55] = {
+    0x00, 0xAF, 0xF0, 0xFF, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0x0F,
+    0x50, 0xF5, 0xAA, 0x50, 0x05,
+    0x50, 0xAF, 0x00, 0x50, 0x0F,
+    0x50, 0x0F, 0x00, 0x50, 0xAA,
+    0xF0, 0x0A, 0x00, 0xF0, 0x0A,
+    0xF0, 0x0A, 0x00, 0xF0, 0x0A,
+    0x55, 0x0A, 0x00, 0x55, 0x0A,
+    0xF5, 0x00, 0x00, 0xF5, 0x00,
+    0xA5, 0x0A, 0x00, 0xA5, 0x0A,
+    0xA5, 0x0A, 0x00, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_006f[55] = {
+    0x00, 0x50, 0xF5, 0x0F, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x50, 0xAF, 0x0A, 0x55, 0xAA,
+    0xF0, 0xAA, 0x00, 0x50, 0x0F,
+    0x55, 0x0A, 0x00, 0x50, 0x05,
+    0xF5, 0x00, 0x00, 0x50, 0x0F,
+    0xA5, 0x0A, 0x00, 0x50, 0xAA,
+    0xF5, 0x00, 0x00, 0x55, 0x0A,
+    0x55, 0xAA, 0x50, 0xF5, 0x00,
+    0x50, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x5F, 0xFF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0070[90] = {
+    0x00, 0xF0, 0x5A, 0xF5, 0x0A, 0x00,
+    0x00, 0x55, 0x5F, 0xFF, 0xAF, 0x00,
+    0x00, 0x55, 0x0F, 0x50, 0xA5, 0x0A,
+    0x00, 0xF5, 0x0A, 0x00, 0xA5, 0x0A,
+    0x00, 0xA5, 0x0A, 0x00, 0xA5, 0x0A,
+    0x00, 0xAF, 0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0xAF, 0x00, 0x00, 0xAF, 0x0A,
+    0x50, 0xA5, 0x00, 0x50, 0xAF, 0x00,
+    0x50, 0xFF, 0x00, 0x55, 0xAA, 0x00,
+    0x50, 0xFA, 0xFF, 0xFF, 0x00, 0x00,
+    0xF0, 0x0A, 0xF5, 0x0F, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0071[75] = {
+    0x00, 0xF0, 0xF5, 0x00, 0x0F,
+    0x00, 0xFF, 0xFF, 0x5F, 0x05,
+    0x50, 0xAF, 0x00, 0xF5, 0xAA,
+    0xF0, 0xAA, 0x00, 0xF0, 0x0A,
+    0x55, 0x0A, 0x00, 0xF0, 0x0A,
+    0xF5, 0x00, 0x00, 0xF0, 0x0A,
+    0xA5, 0x0A, 0x00, 0x55, 0x00,
+    0xF5, 0x00, 0x00, 0xA5, 0x0A,
+    0xF5, 0xAA, 0x50, 0xAF, 0x0A,
+    0xF0, 0xFF, 0xFF, 0xA5, 0x00,
+    0x00, 0xFF, 0xFA, 0xA5, 0x00,
+    0x00, 0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x00, 0x50, 0x0F, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x00, 0x50, 0xAA, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0072[44] = {
+    0x50, 0x05, 0x55, 0xAA,
+    0x50, 0x55, 0xF5, 0x0A,
+    0x50, 0xFF, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00,
+    0xF0, 0xAA, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00,
+    0xA5, 0x0A, 0x00, 0x00,
+    0xAF, 0x00, 0x00, 0x00,
+    0xAF, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0073[55] = {
+    0x00, 0xF0, 0xFF, 0xAA, 0x00,
+    0x50, 0xF5, 0xFF, 0xAF, 0x0A,
+    0x50, 0x0F, 0x00, 0xFF, 0x00,
+    0x50, 0x0F, 0x00, 0x55, 0x0A,
+    0x00, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0xF0, 0xAF, 0x00,
+    0xAF, 0x0A, 0x00, 0xAF, 0x00,
+    0xF5, 0x00, 0x50, 0xA5, 0x00,
+    0x55, 0xFF, 0xFF, 0x0F, 0x00,
+    0x50, 0xF5, 0xAF, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0074[48] = {
+    0x00, 0x50, 0x00,
+    0x00, 0x55, 0x0A,
+    0x00, 0x55, 0x00,
+    0x00, 0xF5, 0x00,
+    0x00, 0xA5, 0x0A,
+    0x55, 0xFF, 0xAF,
+    0xF5, 0xFF, 0xAF,
+    0x50, 0xA5, 0x00,
+    0x50, 0x05, 0x00,
+    0x50, 0xAA, 0x00,
+    0x50, 0xAA, 0x00,
+    0xF0, 0x0A, 0x00,
+    0x55, 0x0A, 0x00,
+    0xF5, 0x00, 0x00,
+    0xF5, 0xAF, 0x00,
+    0xF0, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0075[55] = {
+    0x00, 0xAF, 0x00, 0x00, 0xAF,
+    0x00, 0xAF, 0x00, 0x50, 0xA5,
+    0x50, 0x05, 0x00, 0x50, 0x0F,
+    0x50, 0x0F, 0x00, 0x50, 0xAA,
+    0x50, 0xAA, 0x00, 0x50, 0xAA,
+    0xF0, 0x0A, 0x00, 0xF0, 0x0A,
+    0xF0, 0x0A, 0x00, 0xF5, 0x0A,
+    0x55, 0x0A, 0x00, 0xFF, 0x00,
+    0x55, 0x0A, 0xF0, 0xAF, 0x0A,
+    0x55, 0xFF, 0xAF, 0xAF, 0x0A,
+    0x50, 0xF5, 0x00, 0xA5, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0076[55] = {
+    0xAF, 0x00, 0x00, 0x55, 0x0A,
+    0xA5, 0x00, 0x00, 0xA5, 0x0A,
+    0xA5, 0x0A, 0x50, 0xA5, 0x00,
+    0xA5, 0x0A, 0x50, 0xAA, 0x00,
+    0xF5, 0x00, 0x55, 0x0A, 0x00,
+    0x55, 0x00, 0xA5, 0x0A, 0x00,
+    0x55, 0x5A, 0xA5, 0x00, 0x00,
+    0xF0, 0x5A, 0xAA, 0x00, 0x00,
+    0xF0, 0xFA, 0x0A, 0x00, 0x00,
+    0x50, 0xAF, 0x0A, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0077[77] = {
+    0xAF, 0x00, 0xF0, 0xAA, 0x00, 0x55, 0x00,
+    0xAF, 0x00, 0xF5, 0x0F, 0x00, 0xA5, 0x0A,
+    0xAF, 0x00, 0xF5, 0x05, 0x00, 0xAF, 0x00,
+    0xA5, 0x50, 0xA5, 0x0F, 0x50, 0x0F, 0x00,
+    0xA5, 0x50, 0xAA, 0x0F, 0xF0, 0x0A, 0x00,
+    0xA5, 0xFA, 0x0A, 0xAF, 0x55, 0x00, 0x00,
+    0xA5, 0x5F, 0x00, 0xAF, 0xA5, 0x0A, 0x00,
+    0xA5, 0xAF, 0x0A, 0xAF, 0xAF, 0x00, 0x00,
+    0x55, 0xA5, 0x00, 0xF5, 0x0F, 0x00, 0x00,
+    0x55, 0x0F, 0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0xF5, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0078[66] = {
+    0x00, 0xF5, 0x00, 0x50, 0xA5, 0x0A,
+    0x00, 0xF0, 0x0A, 0xF0, 0x0F, 0x00,
+    0x00, 0x50, 0xAA, 0xF5, 0x0A, 0x00,
+    0x00, 0x50, 0xF5, 0xA5, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x00, 0x50, 0xF5, 0xAA, 0x00, 0x00,
+    0x00, 0xF0, 0xFA, 0x0F, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0xAF, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0xF5, 0x00, 0x00,
+    0x55, 0xAA, 0x00, 0x55, 0x0A, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_0079[90] = {
+    0x00, 0xA5, 0x00, 0x00, 0x55, 0x0A,
+    0x00, 0xA5, 0x0A, 0x00, 0xA5, 0x0A,
+    0x00, 0xA5, 0x0A, 0x50, 0xA5, 0x00,
+    0x00, 0xF5, 0x00, 0x50, 0xAA, 0x00,
+    0x00, 0x55, 0x00, 0x55, 0x0A, 0x00,
+    0x00, 0xF0, 0x0A, 0xA5, 0x0A, 0x00,
+    0x00, 0xF0, 0x5A, 0xA5, 0x00, 0x00,
+    0x00, 0xF0, 0xFA, 0xAA, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0xAF, 0x0A, 0x00, 0x00, 0x00,
+    0xF5, 0xAA, 0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_007a[55] = {
+    0x50, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x50, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x50, 0xA5, 0x0A,
+    0x00, 0x00, 0x55, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00,
+    0x00, 0xF5, 0x0A, 0x00, 0x00,
+    0x50, 0xAF, 0x00, 0x00, 0x00,
+    0x55, 0xAA, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_007b[80] = {
+    0x00, 0x00, 0x55, 0xAA,
+    0x00, 0x50, 0xF5, 0x0A,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x0A, 0x00,
+    0x00, 0x55, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+    0x50, 0xA0, 0x00, 0x00,
+    0xAF, 0x0A, 0x00, 0x00,
+    0xFF, 0x0A, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00,
+    0x50, 0x0A, 0x00, 0x00,
+    0x50, 0x0A, 0x00, 0x00,
+    0xF0, 0x0A, 0x00, 0x00,
+    0x55, 0x0A, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00,
+    0xF5, 0xAF, 0x00, 0x00,
+    0xF0, 0xAF, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_007c[42] = {
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+    0xA5, 0x0A,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_007d[80] = {
+    0x00, 0x50, 0xAF, 0x0A,
+    0x00, 0x50, 0xFF, 0x0A,
+    0x00, 0x00, 0x55, 0x0A,
+    0x00, 0x00, 0x55, 0x00,
+    0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0xA5, 0x0A,
+    0x00, 0x00, 0xA5, 0x00,
+    0x00, 0x00, 0xA5, 0x00,
+    0x00, 0x00, 0xF5, 0x00,
+    0x00, 0x00, 0xF0, 0xAA,
+    0x00, 0x00, 0xF5, 0xAA,
+    0x00, 0x50, 0xA5, 0x00,
+    0x00, 0x50, 0xAA, 0x00,
+    0x00, 0xF0, 0x0A, 0x00,
+    0x00, 0x55, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0x00,
+    0x00, 0xA5, 0x0A, 0x00,
+    0x00, 0xAF, 0x00, 0x00,
+    0xFF, 0x0F, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00,
+};
+
+gui_const uint8_t Font_Arial_Narrow_Italic_21_A4_007e[15] = {
+    0xF0, 0xFF, 0xA0, 0x00, 0x05,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x05, 0x00, 0x5F, 0xFF, 0x00,
+};
+
+gui_const gui_font_char_t Arial_Narrow_Italic_21_A4_CharTable[] = {
+{   7,    1,  0,    0,    0, Font_Arial_Narrow_Italic_21_A4_0020},
+{   6,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0021},
+{   6,    6,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0022},
+{  11,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0023},
+{  10,   19,  0,    3,    0, Font_Arial_Narrow_Italic_21_A4_0024},
+{  15,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0025},
+{  11,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0026},
+{   4,    6,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0027},
+{   6,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0028},
+{   7,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0029},
+{   7,    7,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_002a},
+{  10,   10,  0,    7,    0, Font_Arial_Narrow_Italic_21_A4_002b},
+{   3,    5,  0,   18,    0, Font_Arial_Narrow_Italic_21_A4_002c},
+{   6,    2,  0,   13,    0, Font_Arial_Narrow_Italic_21_A4_002d},
+{   3,    2,  0,   18,    0, Font_Arial_Narrow_Italic_21_A4_002e},
+{   9,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_002f},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0030},
+{   7,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0031},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0032},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0033},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0034},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0035},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0036},
+{   9,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0037},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0038},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0039},
+{   5,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_003a},
+{   5,   14,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_003b},
+{  10,   11,  0,    7,    0, Font_Arial_Narrow_Italic_21_A4_003c},
+{  10,    7,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_003d},
+{  10,   11,  0,    7,    0, Font_Arial_Narrow_Italic_21_A4_003e},
+{   9,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_003f},
+{  18,   21,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0040},
+{  12,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0041},
+{  12,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0042},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0043},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0044},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0045},
+{  12,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0046},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0047},
+{  14,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0048},
+{   6,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0049},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_004a},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_004b},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_004c},
+{  16,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_004d},
+{  14,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_004e},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_004f},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0050},
+{  13,   18,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0051},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0052},
+{  12,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0053},
+{  12,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0054},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0055},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0056},
+{  18,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0057},
+{  15,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0058},
+{  13,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0059},
+{  12,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_005a},
+{   8,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_005b},
+{   4,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_005c},
+{   9,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_005d},
+{   8,    8,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_005e},
+{  11,    2,  0,   21,    0, Font_Arial_Narrow_Italic_21_A4_005f},
+{   4,    3,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0060},
+{  10,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0061},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0062},
+{   9,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0063},
+{  11,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0064},
+{  10,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0065},
+{   8,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0066},
+{  10,   15,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0067},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0068},
+{   5,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0069},
+{   8,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_006a},
+{  10,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_006b},
+{   5,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_006c},
+{  15,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_006d},
+{  10,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_006e},
+{  10,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_006f},
+{  11,   15,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0070},
+{  10,   15,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0071},
+{   8,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0072},
+{   9,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0073},
+{   6,   16,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_0074},
+{  10,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0075},
+{   9,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0076},
+{  13,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0077},
+{  11,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0078},
+{  11,   15,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_0079},
+{   9,   11,  0,    9,    0, Font_Arial_Narrow_Italic_21_A4_007a},
+{   8,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_007b},
+{   3,   21,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_007c},
+{   8,   20,  0,    4,    0, Font_Arial_Narrow_Italic_21_A4_007d},
+{  10,    3,  0,   11,    0, Font_Arial_Narrow_Italic_21_A4_007e},
+};
+
+gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_21_A4 = {
+    _GT("Arial Narrow Italic 22 AA 4 bpp"),
+    22,
+    0x0020,
+    0x007e,
+    GUI_FLAG_FONT_A4,
+    Arial_Narrow_Italic_21_A4_CharTable
+};
@@ -86,6 +86,85 @@ check_disp_clipping(gui_handle_p h) {
     }
 }
 
+/**
+ * \brief           Check if widget is inside any of regions processed after current one in redraw
+ * \note            Current region entry holds only part of region which is not yet drawn
+ * \param[in]       h: Widget handle
+ * \return          `1` if widget will be redrawn again in current redraw, `0` otherwise
+ */
+static uint8_t
+is_inside_next_regions(gui_handle_p h) {
+    size_t i;
+    
+    for (i = GUI.DisplayRedrawIndex; i < GUI.DisplayRedraw.count; i++) {
+        if (GUI.DisplayRedraw.regions[i].y1 < GUI.DisplayRedraw.regions[i].y2 &&
+            guii_widget_isinsideclippingregion(h, &GUI.DisplayRedraw.regions[i])) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#if GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__
+
+/**
+ * \brief           Take memory for virtual layer from scratch memory
+ *
+ *                  Layers of nested transparent widgets are taken one after another
+ *                  and are released in reverse order with \ref scratch_release
+ *
+ * \param[in]       size: Number of bytes for layer structure and pixels
+ * \return          Pointer to memory on success, `NULL` when scratch memory is too small
+ */
+static void*
+scratch_take(size_t size) {
+    uint8_t* ptr;
+    size_t used = GUI.Scratch.used + size;
+    
+    if (used > GUI.Scratch.peak) {                  /* Save required size, memory is enlarged after redraw */
+        GUI.Scratch.peak = used;
+    }
+    if (used > GUI.Scratch.size) {
+        GUI.Scratch.fallbacks++;
+        return NULL;
+    }
+    ptr = GUI.ScratchBuff + GUI.Scratch.used;
+    GUI.Scratch.used = used;
+    return ptr;
+}
+
+/* Release memory of last taken virtual layer */
+static void
+scratch_release(size_t size) {
+    GUI.Scratch.used -= size;
+}
+
+/**
+ * \brief           Enlarge scratch memory
+ * \note            Memory must not be in use, function is called between redraws only
+ * \param[in]       size: Required size in units of bytes
+ * \return          `1` when memory was enlarged, `0` otherwise
+ */
+static uint8_t
+scratch_grow(size_t size) {
+    uint8_t* buff;
+    
+    if (size <= GUI.Scratch.size) {
+        return 0;
+    }
+    buff = GUI_MEMALLOC_CLASS(size, GUI_MEM_CLASS_PIXEL);   /* Layers are blended with DMA */
+    if (buff == NULL) {                             /* Keep old memory */
+        return 0;
+    }
+    GUI_MEMFREE(GUI.ScratchBuff);
+    GUI.ScratchBuff = buff;
+    GUI.Scratch.size = size;
+    GUI.Scratch.grows++;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__ */
+
 /**
  * \brief           Redraw all widgets of selected parent
  * \param[in]       parent: Parent widget handle to draw widgets on
@@ -97,6 +176,8 @@ redraw_widgets(gui_handle_p parent) {
     uint32_t cnt = 0;
     static uint32_t level = 0;
 
+    guii_widget_updatecovered(parent, &GUI.Display);/* Find widgets covered by opaque widgets above them */
+    
     /* Go through all elements of parent */
     for (h = gui_linkedlist_widgetgetnext((gui_handle_root_t *)parent, NULL); h != NULL; 
             h = gui_linkedlist_widgetgetnext(NULL, h)) {
@@ -104,15 +185,26 @@ redraw_widgets(gui_handle_p parent) {
             guii_widget_clrflag(h, GUI_FLAG_REDRAW);   /* Clear flag to be sure */
             continue;                               /* Ignore hidden elements */
         }
-        if (guii_widget_isinsideclippingregion(h)) { /* If widget is inside clipping region */
+        if (guii_widget_isinsideclippingregion(h, &GUI.Display)) { /* If widget is inside clipping region */
+            /* Ignore widget when opaque widgets above it cover it completely */
+            if (guii_widget_getflag(h, GUI_FLAG_COVERED)) {
+                if (!is_inside_next_regions(h)) {
+                    guii_widget_clrflag(h, GUI_FLAG_REDRAW);
+                }
+                continue;
+            }
+            
             /* Draw main widget if required */
             if (guii_widget_getflag(h, GUI_FLAG_REDRAW)) {  /* Check if redraw required */
 #if GUI_CFG_USE_TRANSPARENCY
                 gui_layer_t* layerPrev = GUI.lcd.drawing_layer; /* Save drawing layer */
                 uint8_t transparent = 0;
+                size_t layersize = 0;
 #endif /* GUI_CFG_USE_TRANSPARENCY */
                 
-                guii_widget_clrflag(h, GUI_FLAG_REDRAW);    /* Clear flag for drawing on widget */
+                if (!is_inside_next_regions(h)) {   /* Keep flag if widget must be drawn in next region too */
+                    guii_widget_clrflag(h, GUI_FLAG_REDRAW);    /* Clear flag for drawing on widget */
+                }
                 
                 /*
                  * Prepare clipping region for this widget drawing
@@ -128,16 +220,17 @@ redraw_widgets(gui_handle_p parent) {
                     gui_dim_t height = GUI.DisplayTemp.y2 - GUI.DisplayTemp.y1;
                     
                     /*
-                     * Try to allocate memory for new virtual layer for temporary usage
+                     * Try to take memory for new virtual layer for temporary usage from scratch memory
                      */
-                    GUI.lcd.drawing_layer = GUI_MEMALLOC(sizeof(*GUI.lcd.drawing_layer) + (size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size);
+                    layersize = GUI_MEM_ALIGN(sizeof(*GUI.lcd.drawing_layer)) + GUI_MEM_ALIGN((size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size);
+                    GUI.lcd.drawing_layer = scratch_take(layersize);
                     
-                    if (GUI.lcd.drawing_layer != NULL) {/* Check if allocation was successful */
+                    if (GUI.lcd.drawing_layer != NULL) {/* Check if memory is available */
                         GUI.lcd.drawing_layer->width = width;
                         GUI.lcd.drawing_layer->height = height;
                         GUI.lcd.drawing_layer->x_offset = GUI.DisplayTemp.x1;
                         GUI.lcd.drawing_layer->y_offset = GUI.DisplayTemp.y1;
-                        GUI.lcd.drawing_layer->start_address = (uint32_t)((char *)GUI.lcd.drawing_layer) + sizeof(*GUI.lcd.drawing_layer);
+                        GUI.lcd.drawing_layer->start_address = (uintptr_t)((char *)GUI.lcd.drawing_layer) + GUI_MEM_ALIGN(sizeof(*GUI.lcd.drawing_layer));
                         transparent = 1;            /* We are going to transparent drawing mode */
                     } else {
                         GUI.lcd.drawing_layer = layerPrev;  /* Reset layer back */
@@ -150,6 +243,7 @@ redraw_widgets(gui_handle_p parent) {
                  */
                 GUI_WIDGET_PARAMTYPE_DISP(&GUI.WidgetParam) = &GUI.DisplayTemp;  /* Set parameter */
                 guii_widget_callback(h, GUI_WC_Draw, &GUI.WidgetParam, &GUI.WidgetResult); /* Draw widget */
+                guii_draw_flush();                  /* Send pending batched drawing operations */
                 
                 /* Check if there are children widgets in this widget */
                 if (guii_widget_allowchildren(h)) {
@@ -181,7 +275,8 @@ redraw_widgets(gui_handle_p parent) {
                         0, layerPrev->width - GUI.lcd.drawing_layer->width
                     );
                     
-                    GUI_MEMFREE(GUI.lcd.drawing_layer); /* Free memory for virtual layer */
+                    guii_ll_wait();                 /* Wait for queued operations on virtual layer */
+                    scratch_release(layersize);     /* Release memory of virtual layer */
                     GUI.lcd.drawing_layer = layerPrev;  /* Reset layer pointer */
                 }
 #endif /* GUI_CFG_USE_TRANSPARENCY */
@@ -681,7 +776,11 @@ process_redraw(void) {
     gui_layer_t* active = GUI.lcd.active_layer;
     gui_layer_t* drawing = GUI.lcd.drawing_layer;
     uint8_t result = 1;
-    gui_display_t* dispA = &active->display;
+    gui_display_t* dispA;
+    size_t i;
+#if GUI_CFG_USE_PARTIAL_BUFFER
+    gui_dim_t lines;
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
     
     if ((GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM) || !(GUI.flags & GUI_FLAG_REDRAW)) {  /* Check if anything to draw first */
         return;
@@ -689,19 +788,95 @@ process_redraw(void) {
     
     GUI.flags &= ~GUI_FLAG_REDRAW;                  /* Clear redraw flag */
     
-    /* Copy from currently active layer to drawing layer only changes on layer */
-    GUI.ll.Copy(&GUI.lcd, drawing, 
-        (void *)(active->start_address + GUI.lcd.pixel_size * (dispA->y1 * active->width + dispA->x1)), /* Source address */
-        (void *)(drawing->start_address + GUI.lcd.pixel_size * (dispA->y1 * drawing->width + dispA->x1)),   /* Destination address */
-        dispA->x2 - dispA->x1,                      /* Area width */
-        dispA->y2 - dispA->y1,                      /* Area height */
-        active->width - (dispA->x2 - dispA->x1),    /* Offline source */
-        drawing->width - (dispA->x2 - dispA->x1)    /* Offline destination */
-    );
-    
-    redraw_widgets(NULL);                           /* Redraw all widgets now on drawing layer */
+    /* Take invalid regions for this redraw, new invalidations go to next redraw */
+    memcpy(&GUI.DisplayRedraw, &GUI.DisplayInvalid, sizeof(GUI.DisplayRedraw));
+    GUI.DisplayInvalid.count = 0;
+    
+    /*
+     * Bring drawing layer up to date with active layer.
+     * Copy only regions drawing layer missed since it was drawn last time,
+     * nothing has to be copied when drawing on the same layer as active one
+     */
+    for (i = 0; drawing != active && i < drawing->missed.count; i++) {
+        dispA = &drawing->missed.regions[i];
+        GUI.ll.Copy(&GUI.lcd, drawing, 
+            (void *)(active->start_address + GUI.lcd.pixel_size * (dispA->y1 * active->width + dispA->x1)), /* Source address */
+            (void *)(drawing->start_address + GUI.lcd.pixel_size * (dispA->y1 * drawing->width + dispA->x1)),   /* Destination address */
+            dispA->x2 - dispA->x1,                  /* Area width */
+            dispA->y2 - dispA->y1,                  /* Area height */
+            active->width - (dispA->x2 - dispA->x1),/* Offline source */
+            drawing->width - (dispA->x2 - dispA->x1)/* Offline destination */
+        );
+    }
+    drawing->missed.count = 0;                      /* Drawing layer is in sync now */
+    
+    /*
+     * Redraw all widgets now on drawing layer, each region separatelly.
+     *
+     * When partial buffer is used, region is drawn in bands of lines which fit to buffer.
+     * During drawing, region entry is reduced to part not yet drawn and restored afterwards
+     */
+    for (GUI.DisplayRedrawIndex = 0; GUI.DisplayRedrawIndex < GUI.DisplayRedraw.count; GUI.DisplayRedrawIndex++) {
+        gui_display_t* r = &GUI.DisplayRedraw.regions[GUI.DisplayRedrawIndex];
+        gui_dim_t y = r->y1;
+        
+        while (r->y1 < r->y2) {
+            memcpy(&GUI.Display, r, sizeof(GUI.Display));
+#if GUI_CFG_USE_PARTIAL_BUFFER
+            lines = (gui_dim_t)(GUI.lcd.buffer_size / ((size_t)GUI.lcd.pixel_size * (size_t)(r->x2 - r->x1)));
+            if (lines == 0) {                       /* Buffer too small even for one line, rejected by gui_init */
+                GUI_DEBUG("Partial buffer too small for line of region in file %s and line %d\r\n", (const char *)__FILE__, (unsigned)__LINE__);
+                break;
+            }
+            if (GUI.Display.y2 - GUI.Display.y1 > lines) {
+                GUI.Display.y2 = GUI.Display.y1 + lines;
+            }
+            drawing->x_offset = GUI.Display.x1;     /* Set buffer position on screen */
+            drawing->y_offset = GUI.Display.y1;
+            drawing->width = GUI.Display.x2 - GUI.Display.x1;
+            drawing->height = GUI.Display.y2 - GUI.Display.y1;
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
+            r->y1 = GUI.Display.y2;                 /* Remaining part of region */
+            redraw_widgets(NULL);                   /* Redraw widgets inside current region */
+#if GUI_CFG_USE_PARTIAL_BUFFER
+            if (GUI.ll.Flush != NULL) {
+                GUI.ll.Flush(&GUI.lcd, drawing);    /* Send band to LCD */
+            }
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
+        }
+        r->y1 = y;                                  /* Restore region */
+    }
+#if GUI_CFG_USE_TRANSPARENCY
+    /*
+     * When scratch memory was too small for virtual layers,
+     * enlarge it now and redraw all widgets again with transparency on next redraw
+     */
+    if (scratch_grow(GUI.Scratch.peak)) {
+        gui_handle_p h;
+        for (h = gui_linkedlist_widgetgetnext(NULL, NULL); h != NULL; h = gui_linkedlist_widgetgetnext(NULL, h)) {
+            guii_widget_invalidate(h);
+        }
+    }
+#endif /* GUI_CFG_USE_TRANSPARENCY */
     drawing->pending = 1;                           /* Set drawing layer as pending */
     
+    /* All other layers missed regions drawn in this redraw */
+    for (i = 0; i < GUI.lcd.layer_count; i++) {
+        gui_layer_t* layer = &GUI.lcd.layers[i];
+        size_t r;
+        
+        if (layer != drawing) {
+            for (r = 0; r < GUI.DisplayRedraw.count; r++) {
+                dispA = &GUI.DisplayRedraw.regions[r];
+                guii_lcd_region_add(&layer->missed, dispA->x1, dispA->y1, dispA->x2, dispA->y2);
+            }
+        }
+    }
+    
+#if GUI_CFG_USE_PARTIAL_BUFFER
+    GUI_UNUSED2(active, result);
+    drawing->pending = 0;                           /* Bands are already sent to LCD */
+#else
     /* Notify low-level about layer change */
     GUI.lcd.flags |= GUI_FLAG_LCD_WAIT_LAYER_CONFIRM;
     gui_ll_control(&GUI.lcd, GUI_LL_Command_SetActiveLayer, &drawing, &result); /* Set new active layer to low-level driver */
@@ -710,10 +885,9 @@ process_redraw(void) {
     /* New drawings won't be affected until confirmation from low-level is not received */
     GUI.lcd.active_layer = drawing;
     GUI.lcd.drawing_layer = active;
+#endif /* !GUI_CFG_USE_PARTIAL_BUFFER */
     
-    memcpy(&GUI.lcd.active_layer->display, &GUI.Display, sizeof(GUI.Display));  /* Copy clipping data to region */
-    
-    /* Invalid clipping region(s) for next drawing process */
+    /* Invalid clipping region for next drawing process */
     GUI.Display.x1 = 0x7FFF;
     GUI.Display.y1 = 0x7FFF;
     GUI.Display.x2 = 0x8000;
@@ -752,6 +926,10 @@ gui_init(void) {
     uint8_t result;
     
     memset((void *)&GUI, 0x00, sizeof(GUI));        /* Reset GUI structure */
+    GUI.Display.x1 = 0x7FFF;                        /* Invalid clipping region */
+    GUI.Display.y1 = 0x7FFF;
+    GUI.Display.x2 = 0x8000;
+    GUI.Display.y2 = 0x8000;
     
     gui_seteventcallback(NULL);                     /* Set event callback */
     
@@ -765,27 +943,52 @@ gui_init(void) {
     result = 1;
     gui_ll_control(&GUI.lcd, GUI_LL_Command_Init, &GUI.ll, &result);/* Call low-level initialization */
     GUI.ll.Init(&GUI.lcd);                          /* Call user LCD driver function */
+#if GUI_CFG_USE_MEM_POOLS
+    if (!gui_mem_reservepools()) {                  /* Pools must have memory before first allocation */
+        return guiERROR;
+    }
+#endif /* GUI_CFG_USE_MEM_POOLS */
     
     /* Check situation with layers */
     if (GUI.lcd.layer_count >= 1) {
         size_t i;
+        
+#if GUI_CFG_USE_PARTIAL_BUFFER
+        /* Bands are drawn line by line, buffer must hold at least one full line of screen */
+        if (GUI.lcd.buffer_size < (size_t)GUI.lcd.pixel_size * (size_t)GUI.lcd.width) {
+            return guiERROR;
+        }
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
         /* Set default values for all layers */
         for (i = 0; i < GUI.lcd.layer_count; i++) {
             GUI.lcd.layers[i].x_offset = 0;
             GUI.lcd.layers[i].y_offset = 0;
             GUI.lcd.layers[i].width = GUI.lcd.width;
             GUI.lcd.layers[i].height = GUI.lcd.height;
+            
+            /* Content of other layers is unknown, sync them with first layer before first drawing */
+            GUI.lcd.layers[i].missed.count = 0;
+            if (i > 0) {
+                guii_lcd_region_add(&GUI.lcd.layers[i].missed, 0, 0, GUI.lcd.width, GUI.lcd.height);
+            }
         }
         GUI.lcd.active_layer = &GUI.lcd.layers[0];
         GUI.lcd.drawing_layer = &GUI.lcd.layers[0];
+#if !GUI_CFG_USE_PARTIAL_BUFFER
+        /* Partial buffer cannot hold entire screen, it is set for each band on redraw */
         GUI.ll.Fill(&GUI.lcd, GUI.lcd.drawing_layer, (void *)GUI.lcd.drawing_layer->start_address, GUI.lcd.width, GUI.lcd.height, 0, GUI_COLOR_LIGHTGRAY);
         if (GUI.lcd.layer_count > 1) {
             GUI.lcd.drawing_layer = &GUI.lcd.layers[1];
         }
+#endif /* !GUI_CFG_USE_PARTIAL_BUFFER */
     } else {
         return guiERROR;
     }
     
+#if GUI_CFG_USE_TRANSPARENCY
+    scratch_grow(GUI_CFG_TRANSPARENCY_BUFFER_SIZE); /* Allocate scratch memory for virtual layers before first redraw */
+#endif /* GUI_CFG_USE_TRANSPARENCY */
+    
     gui_input_init();                               /* Init input devices */
     GUI.Initialized = 1;                            /* GUI is initialized */
     guii_widget_init();                              /* Init widgets */
@@ -837,6 +1040,26 @@ gui_process(void) {
     return 0;                                       /* Return number of elements updated on GUI */
 }
 
+#if GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__
+
+/**
+ * \brief           Get statistics of scratch memory for virtual layers of transparent widgets
+ * \param[out]      stats: Pointer to \ref gui_scratch_stats_t structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_getscratchstats(gui_scratch_stats_t* stats) {
+    __GUI_ASSERTPARAMS(stats != NULL);              /* Check input parameters */
+    __GUI_ENTER();                                  /* Enter GUI */
+    
+    *stats = GUI.Scratch;                           /* Copy statistics */
+    
+    __GUI_LEAVE();                                  /* Leave GUI */
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__ */
+
 /**
  * \brief           Set callback for global events from GUI
  * \param[in]       cb: Callback function
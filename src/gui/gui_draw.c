@@ -64,6 +64,37 @@ typedef struct {
     uint8_t IsBreak;                                /*!< Status indicating break occurred */
 } gui_stringrectvars_t;
 
+typedef struct {
+    const gui_display_t* disp;                      /*!< Display region spans are clipped to */
+    gui_color_t color;                              /*!< Color used for drawing operation */
+    gui_dim_t x1, x2;                               /*!< Pending rectangle X start and end, end is not included */
+    gui_dim_t y1, y2;                               /*!< Pending rectangle Y start and end, end is not included */
+} gui_draw_spans_t;
+
+typedef struct gui_draw_poly_edge {
+    struct gui_draw_poly_edge* next;                /*!< Next edge in list of active edges */
+    int32_t x;                                      /*!< Integer part of X position on current row */
+    int32_t frac;                                   /*!< Fractional part of X position in units of `1 / dy` */
+    int32_t step;                                   /*!< Integer part of X increment per row */
+    int32_t stepfrac;                               /*!< Fractional part of X increment per row in units of `1 / dy` */
+    int32_t dy;                                     /*!< Edge height, denominator of fractional parts */
+    gui_dim_t y1;                                   /*!< First row crossed by edge */
+    gui_dim_t y2;                                   /*!< Row after last row crossed by edge */
+    int8_t dir;                                     /*!< Edge direction, `1` when going down, `-1` when going up */
+} gui_draw_poly_edge_t;
+
+typedef struct {
+    const gui_display_t* disp;                      /*!< Display region line is clipped to */
+    const gui_draw_font_t* draw;                    /*!< Drawing parameters with colors */
+    uint8_t* buff;                                  /*!< Pointer to first row of line in scratch buffer */
+    gui_dim_t stride;                               /*!< Number of bytes between rows in scratch buffer */
+    gui_dim_t x1, x2;                               /*!< Visible line X start and end of composed characters */
+    gui_dim_t y1, y2;                               /*!< Visible line rows, y2 is not included */
+} gui_draw_textline_t;
+
+#define POLY_EDGES_LOCAL        8                   /*!< Number of polygon edges processed without memory allocation */
+#define POLY_EDGE_X(e)          ((e)->x + ((e)->frac > 0))  /*!< First pixel on the right side of edge */
+
 #define CH_CR           GUI_KEY_CR
 #define CH_LF           GUI_KEY_LF
 #define CH_WS           GUI_KEY_WS
@@ -71,6 +102,142 @@ typedef struct {
 
 static gui_stringrectvars_t var;
 
+#define BATCH_RECTS             0x01                /*!< Batch of rectangles to fill */
+#define BATCH_CHARS             0x02                /*!< Batch of characters to copy */
+
+/**
+ * \brief           Send pending batched drawing operations to low-level driver
+ * \note            Must be called before any operation which is not batched
+ *                  and before drawing layer content is used outside drawing functions
+ */
+void
+guii_draw_flush(void) {
+#if GUI_CFG_LL_BATCH_SIZE
+    gui_ll_batch_t* b = &GUI.Batch;
+    
+    if (b->count) {
+        if (b->type == BATCH_RECTS) {
+            GUI.ll.FillRects(&GUI.lcd, b->layer, b->ops.rects, b->count, b->color);
+        } else {
+            GUI.ll.CopyChars(&GUI.lcd, b->layer, b->ops.chars, b->count, b->color);
+        }
+        b->count = 0;
+    }
+#endif /* GUI_CFG_LL_BATCH_SIZE */
+}
+
+#if GUI_CFG_LL_BATCH_SIZE
+/**
+ * \brief           Prepare batch for new operation of specific type and color
+ *
+ *                  Pending operations are sent to low-level driver first
+ *                  when batch is full or new operation cannot be added to it.
+ *
+ * \param[in]       type: Type of operation to add
+ * \param[in]       color: Color of operation to add
+ * \return          Index of operation in batch
+ */
+static size_t
+batch_add(uint8_t type, gui_color_t color) {
+    gui_ll_batch_t* b = &GUI.Batch;
+    
+    if (b->count == GUI_CFG_LL_BATCH_SIZE || b->type != type || 
+        b->color != color || b->layer != GUI.lcd.drawing_layer) {
+        guii_draw_flush();
+        b->type = type;
+        b->color = color;
+        b->layer = GUI.lcd.drawing_layer;
+    }
+    return b->count++;
+}
+#endif /* GUI_CFG_LL_BATCH_SIZE */
+
+/**
+ * \brief           Fill rectangle on drawing layer
+ * \note            Rectangle must be already clipped to drawing region
+ * \param[in]       x: Top left X position on screen
+ * \param[in]       y: Top left Y position on screen
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       color: Color used for drawing operation
+ */
+static void
+draw_fillrect(gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    x -= GUI.lcd.drawing_layer->x_offset;
+    y -= GUI.lcd.drawing_layer->y_offset;
+    
+#if GUI_CFG_LL_BATCH_SIZE
+    if (GUI.ll.FillRects != NULL) {                 /* Collect rectangles to single call */
+        gui_ll_rect_t* r = &GUI.Batch.ops.rects[batch_add(BATCH_RECTS, color)];
+        r->x = x;
+        r->y = y;
+        r->width = width;
+        r->height = height;
+        return;
+    }
+#endif /* GUI_CFG_LL_BATCH_SIZE */
+    if (height == 1) {
+        GUI.ll.DrawHLine(&GUI.lcd, GUI.lcd.drawing_layer, x, y, width, color);
+    } else if (width == 1) {
+        GUI.ll.DrawVLine(&GUI.lcd, GUI.lcd.drawing_layer, x, y, height, color);
+    } else {
+        GUI.ll.FillRect(&GUI.lcd, GUI.lcd.drawing_layer, x, y, width, height, color);
+    }
+}
+
+/**
+ * \brief           Copy alpha only character data to drawing layer with color
+ * \param[in]       src: Pointer to alpha only source data
+ * \param[in]       dst: Pointer to destination on drawing layer
+ * \param[in]       width: Area width
+ * \param[in]       height: Area height
+ * \param[in]       offlinesrc: Number of bytes to skip in source after each line
+ * \param[in]       offlinedst: Number of pixels to skip in destination after each line
+ * \param[in]       color: Color used for drawing operation
+ */
+static void
+draw_copychar(const void* src, void* dst, gui_dim_t width, gui_dim_t height, gui_dim_t offlinesrc, gui_dim_t offlinedst, gui_color_t color) {
+#if GUI_CFG_LL_BATCH_SIZE
+    if (GUI.ll.CopyChars != NULL) {                 /* Collect characters to single call */
+        gui_ll_char_t* ch = &GUI.Batch.ops.chars[batch_add(BATCH_CHARS, color)];
+        ch->src = src;
+        ch->dst = dst;
+        ch->width = width;
+        ch->height = height;
+        ch->offlinesrc = offlinesrc;
+        ch->offlinedst = offlinedst;
+        return;
+    }
+#endif /* GUI_CFG_LL_BATCH_SIZE */
+    GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, src, dst, width, height, offlinesrc, offlinedst, color);
+}
+
+/**
+ * \brief           Copy part of character alpha data to drawing layer
+ * \param[in]       src: Pointer to first line of character alpha data
+ * \param[in]       a4: Set to `1` when source is 4-bit alpha from font, or `0` for 8-bit alpha
+ * \param[in]       offset: Offset of first copied pixel from start of source in units of pixels.
+ *                      For 4-bit alpha it must be even number
+ * \param[in]       dst: Destination address in drawing layer
+ * \param[in]       width: Area width
+ * \param[in]       height: Area height
+ * \param[in]       offlinesrc: Number of pixels to skip in source after each line
+ * \param[in]       offlinedst: Number of pixels to skip in destination after each line
+ * \param[in]       color: Color used for drawing operation
+ */
+static void
+draw_char_copy(const uint8_t* src, uint8_t a4, gui_dim_t offset, void* dst, gui_dim_t width, gui_dim_t height, gui_dim_t offlinesrc, gui_dim_t offlinedst, gui_color_t color) {
+    if (a4) {
+        guii_draw_flush();                          /* Keep order with pending operations */
+        GUI.ll.CopyCharA4(&GUI.lcd, GUI.lcd.drawing_layer, src + offset / 2, dst, width, height, offlinesrc, offlinedst, color);
+    } else {
+        draw_copychar(src + offset, dst, width, height, offlinesrc, offlinedst, color);
+    }
+}
+
 /**
  * \brief           Get info structure from font for given character
  * \param[in]       font: Font to use for drawing
@@ -325,8 +492,139 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
     return var.cnt;                                 /* Return number of characters to read in current line */
 }
 
+/**
+ * \brief           Get pointer to alpha data of character entry
+ * \hideinitializer
+ */
+#define CHAR_ENTRY_DATA(entry)      ((uint8_t *)(entry) + GUI_MEM_ALIGN(sizeof(gui_font_charentry_t)))
+
+/**
+ * \brief           Get hash bucket index for font and character
+ * \hideinitializer
+ */
+#define CHAR_ENTRY_HASH(font, c)    ((size_t)((((uintptr_t)(c)) >> 2) ^ (((uintptr_t)(font)) >> 4)) & (GUI_CFG_FONT_CACHE_HASH_SIZE - 1))
+
+/**
+ * \brief           Get 8-bit alpha value of pixel in 4-bit alpha font data
+ * \param[in]       data: Pointer to character data
+ * \param[in]       line: Offset of line from start of data in units of bytes
+ * \param[in]       x: Pixel position in line
+ * \hideinitializer
+ */
+#define CHAR_A4_ALPHA(data, line, x)    ((uint8_t)((((x) & 0x01) ? ((data)[(line) + ((x) >> 1)] >> 4) : ((data)[(line) + ((x) >> 1)] & 0x0F)) * 0x11))
+
+/**
+ * \brief           Decode single line of character to 8-bit alpha values
+ * \param[in]       font: Font used for character
+ * \param[in]       c: Character info handle
+ * \param[in]       row: Line number in character
+ * \param[out]      buff: Buffer for \ref gui_font_char_t.x_size alpha values
+ * \return          Pointer to alpha values of line, either in font data or in buffer
+ */
+static const uint8_t *
+char_get_alpha_line(const gui_font_t* font, const gui_font_char_t* c, gui_dim_t row, uint8_t* buff) {
+    static const uint8_t aa[] = {0x00, 0x55, 0xAA, 0xFF};
+    const uint8_t* data;
+    uint16_t x;
+    
+    if (font->flags & GUI_FLAG_FONT_A8) {           /* 8-bit alpha font */
+        return &c->data[row * c->x_size];
+    } else if (font->flags & GUI_FLAG_FONT_A4) {    /* 4-bit alpha font, each line starts on new byte */
+        data = &c->data[row * ((c->x_size + 1) >> 1)];
+        for (x = 0; x < c->x_size; x++) {
+            buff[x] = CHAR_A4_ALPHA(data, 0, x);
+        }
+    } else if (font->flags & GUI_FLAG_FONT_AA) {    /* Anti-alliased font with 2 bits per pixel */
+        data = &c->data[row * ((c->x_size + 3) >> 2)];
+        for (x = 0; x < c->x_size; x++) {
+            buff[x] = aa[(data[x >> 2] >> (6 - 2 * (x & 0x03))) & 0x03];
+        }
+    } else {                                        /* 1 bit per pixel */
+        data = &c->data[row * ((c->x_size + 7) >> 3)];
+        for (x = 0; x < c->x_size; x++) {
+            buff[x] = (data[x >> 3] & (0x80 >> (x & 0x07))) ? 0xFF : 0x00;
+        }
+    }
+    return buff;
+}
+
+/**
+ * \brief           Divide value between `0` and `255 * 255` by `255` with rounding
+ * \hideinitializer
+ */
+#define DIV255(t)                       (((t) + 128 + (((t) + 128) >> 8)) >> 8)
+
+/**
+ * \brief           Blend color over ARGB8888 pixel with 8-bit alpha
+ * \param[in]       d: Destination pixel
+ * \param[in]       s: Source color. Alpha channel is ignored
+ * \param[in]       a: Coverage of source color
+ * \return          Blended pixel
+ */
+static uint32_t
+blend_color(uint32_t d, uint32_t s, uint32_t a) {
+    uint32_t ia = 255 - a;
+    
+    return DIV255(255 * a + ((d >> 24) & 0xFF) * ia) << 24
+        | DIV255(((s >> 16) & 0xFF) * a + ((d >> 16) & 0xFF) * ia) << 16
+        | DIV255(((s >> 8) & 0xFF) * a + ((d >> 8) & 0xFF) * ia) << 8
+        | DIV255((s & 0xFF) * a + (d & 0xFF) * ia);
+}
+
+/**
+ * \brief           Draw horizontal span of pixels with the same alpha and color
+ * \note            When writing directly to memory, ARGB8888 is used for 4-byte pixels
+ *                      and RGB565 for 2-byte pixels, same as in \ref GUI_LL_SOFT module.
+ *                      Driver allows it with \ref GUI_FLAG_LCD_CPU_ACCESS flag
+ * \param[in]       x: Start X position on screen
+ * \param[in]       y: Y position on screen
+ * \param[in]       len: Number of pixels in span
+ * \param[in]       a: Coverage of color between `1` and `255`
+ * \param[in]       color: Color used for drawing operation
+ * \param[in]       direct: Set to `1` to write to drawing layer memory with CPU,
+ *                      or `0` to use low-level driver
+ */
+static void
+draw_alpha_span(gui_dim_t x, gui_dim_t y, gui_dim_t len, uint8_t a, gui_color_t color, uint8_t direct) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_color_t c;
+    
+    x -= layer->x_offset;                           /* Go to layer coordinates */
+    y -= layer->y_offset;
+    if (direct) {
+        if (GUI.lcd.pixel_size == 4) {
+            uint32_t* d = (uint32_t *)(layer->start_address + (y * layer->width + x) * 4);
+            for (; len > 0; len--, d++) {
+                *d = a == 0xFF ? (color | 0xFF000000UL) : blend_color(*d, color, a);
+            }
+        } else {
+            uint16_t* d = (uint16_t *)(layer->start_address + (y * layer->width + x) * 2);
+            uint32_t r, g, b;
+            for (; len > 0; len--, d++) {
+                c = color;
+                if (a != 0xFF) {                    /* Convert destination from RGB565 and blend */
+                    r = (*d >> 11) & 0x1F;
+                    g = (*d >> 5) & 0x3F;
+                    b = *d & 0x1F;
+                    c = blend_color(0xFF000000UL | ((r << 3) | (r >> 2)) << 16 | ((g << 2) | (g >> 4)) << 8 | ((b << 3) | (b >> 2)), color, a);
+                }
+                *d = (uint16_t)((((c >> 19) & 0x1F) << 11) | (((c >> 10) & 0x3F) << 5) | ((c >> 3) & 0x1F));
+            }
+        }
+    } else if (a == 0xFF) {                         /* Solid span */
+        draw_fillrect(x + layer->x_offset, y + layer->y_offset, len, 1, color);
+    } else {
+        guii_draw_flush();                          /* Pixels may be changed by pending batch */
+        for (; len > 0; len--, x++) {
+            c = GUI.ll.GetPixel(&GUI.lcd, layer, x, y);
+            GUI.ll.SetPixel(&GUI.lcd, layer, x, y, blend_color(c, color, a));
+        }
+    }
+}
+
 /**
  * \brief           Get character entry generated in memory for fast drawing
+ * \note            Found entry is moved to the end of least recently used list
  * \param[in]       font: Font used for character
  * \param[in]       c: Character info handle
  * \return          Character entry or NULL on failure
@@ -335,20 +633,54 @@ static gui_font_charentry_t *
 get_char_entry_from_font(const gui_font_t* font, const gui_font_char_t* c) {
     gui_font_charentry_t* entry;
     
-    for (entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&GUI.RootFonts, NULL); entry != NULL;
-        entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry)) {
+    for (entry = GUI.FontHash[CHAR_ENTRY_HASH(font, c)]; entry != NULL; entry = entry->next_hash) {
         if (entry->Font == font && entry->Ch == c) {
+            gui_linkedlist_remove_gen(&GUI.RootFonts, (gui_linkedlist_t *)entry);   /* Move entry to the end as most recently used */
+            gui_linkedlist_add_gen(&GUI.RootFonts, (gui_linkedlist_t *)entry);
+            GUI.FontCache.hits++;
             return entry;
         }
     }
+    GUI.FontCache.misses++;
     return 0;
 }
 
+/**
+ * \brief           Remove least recently used character entry from cache
+ * \return          1 if entry removed, 0 if cache is empty
+ */
+static uint8_t
+remove_char_entry_lru(void) {
+    gui_font_charentry_t* entry;
+    gui_font_charentry_t** prev;
+    
+    entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&GUI.RootFonts, NULL);
+    if (entry == NULL) {
+        return 0;
+    }
+    
+    /* Remove entry from hash bucket */
+    for (prev = &GUI.FontHash[CHAR_ENTRY_HASH(entry->Font, entry->Ch)]; *prev != NULL; prev = &(*prev)->next_hash) {
+        if (*prev == entry) {
+            *prev = entry->next_hash;
+            break;
+        }
+    }
+    gui_linkedlist_remove_gen(&GUI.RootFonts, (gui_linkedlist_t *)entry);
+    
+    guii_draw_flush();                              /* Entry may be used by pending batch */
+    guii_ll_wait();                                 /* Entry may still be used by queued copy operation */
+    GUI.FontCache.size -= entry->size;
+    GUI.FontCache.count--;
+    GUI.FontCache.evictions++;
+    GUI_MEMFREE(entry);                             /* Free memory */
+    return 1;
+}
+
 /* Create char and put it to RAM for fast drawing with memory to memory copy */
 static gui_font_charentry_t *
 create_char_entry_from_font(const gui_font_t* font, const gui_font_char_t* c) {
     gui_font_charentry_t* entry = NULL;
-    uint16_t columns;
     uint16_t memsize = GUI_MEM_ALIGN(sizeof(*entry));   /* Get size of entry */
     uint16_t memDataSize;
     
@@ -356,71 +688,39 @@ create_char_entry_from_font(const gui_font_t* font, const gui_font_char_t* c) {
     memDataSize = c->x_size * c->y_size;
     
     memsize += GUI_MEM_ALIGN(memDataSize);          /* align memory before increase */
-    entry = GUI_MEMALLOC(memsize);                  /* Allocate memory for entry */
+    if (memsize > GUI_CFG_FONT_CACHE_SIZE) {        /* Character can never fit to cache */
+        return NULL;
+    }
+    while ((GUI.FontCache.size + memsize) > GUI_CFG_FONT_CACHE_SIZE) {
+        remove_char_entry_lru();                    /* Make space for new entry */
+    }
+    while ((entry = GUI_MEMALLOC_CLASS(memsize, GUI_MEM_CLASS_PIXEL)) == NULL) {   /* Allocate memory for entry */
+        if (!remove_char_entry_lru()) {             /* Try again with less cached characters */
+            break;
+        }
+    }
     if (entry != NULL) {                            /* Allocation was successful */
-        uint16_t i, x;
-        uint8_t b, k, t;
-        uint8_t* ptr = (uint8_t *)entry;            /* Go to memory size */
-        ptr += GUI_MEM_ALIGN(sizeof(*entry));       /* Go to start of data, at the end of aligned structure size */
+        uint16_t i;
+        const uint8_t* line;
+        uint8_t* ptr = CHAR_ENTRY_DATA(entry);      /* Go to start of data, at the end of aligned structure size */
+        size_t hash = CHAR_ENTRY_HASH(font, c);
         
         entry->Ch = c;                              /* Set pointer to character */
         entry->Font = font;                         /* Set pointer to font structure */
+        entry->size = memsize;                      /* Set size of entry */
         
-        if (font->flags & GUI_FLAG_FONT_AA) {       /* Anti-alliased font */
-            columns = c->x_size >> 2;               /* Calculate number of bytes used for single character line */
-            if (c->x_size % 4) {                    /* If only 1 column used */
-                columns++;
-            }
-            x = 0;
-            for (i = 0; i < c->y_size * columns; i++) { /* Inspect all vertical lines */
-                b = c->data[i];                     /* Get byte of data */
-                for (k = 0; k < 4; k++) {           /* Scan each bit in byte */
-                    t = (b >> (6 - 2 * k)) & 0x03;  /* Get temporary bits on bottom */
-                    switch (t) {
-                        case 0:
-                            *ptr |= 0x00;
-                            break;
-                        case 1:
-                            *ptr |= 0x55;
-                            break;
-                        case 2:
-                            *ptr |= 0xAA;
-                            break;
-                        default:
-                            *ptr |= 0xFF;
-                    }
-                    ptr++;
-                    x++;
-                    if (x == c->x_size) {
-                        x = 0;
-                        break;
-                    }
-                }
-            }
-        } else {
-            columns = c->x_size >> 3;               /* Calculate number of bytes used for single character line */
-            if (c->x_size % 8) {                    /* If only 1 column used */
-                columns++;
-            }
-            x = 0;
-            for (i = 0; i < c->y_size * columns; i++) {  /* Inspect all vertical lines */
-                b = c->data[i];                     /* Get byte of data */
-                for (k = 0; k < 8; k++) {           /* Scan each bit in byte */
-                    if ((b >> (7 - k)) & 0x01) {
-                        *ptr++ = 0xFF;
-                    } else {
-                        *ptr++ = 0x00;
-                    }
-                    x++;
-                    if (x == c->x_size) {
-                        x = 0;
-                        break;
-                    }
-                }
+        for (i = 0; i < c->y_size; i++, ptr += c->x_size) {  /* Decode line by line */
+            line = char_get_alpha_line(font, c, i, ptr);
+            if (line != ptr) {                      /* Alpha values are ready in font */
+                memcpy(ptr, line, c->x_size);
             }
         }
         
         gui_linkedlist_add_gen(&GUI.RootFonts, (gui_linkedlist_t *)entry);  /* Add entry to linked list */
+        entry->next_hash = GUI.FontHash[hash];      /* Add entry to hash bucket */
+        GUI.FontHash[hash] = entry;
+        GUI.FontCache.size += memsize;
+        GUI.FontCache.count++;
     }
     return entry;                                   /* Return new created entry */
 }
@@ -429,10 +729,10 @@ create_char_entry_from_font(const gui_font_t* font, const gui_font_char_t* c) {
 /* X and Y coordinates are TOP LEFT coordinates for character */
 static void
 draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_font_t* draw, gui_dim_t x, gui_dim_t y, const gui_font_char_t* c) {
-    uint8_t i, b, k, columns;
-    gui_dim_t x1;
-    
-    while (!GUI.ll.IsReady(&GUI.lcd));              /* Wait till ready */
+    uint8_t buff[256];                              /* Decoded line, character width is always below 256 */
+    const uint8_t* line;
+    gui_dim_t x1, x2, y1, y2, row, px, end, split;
+    uint8_t a, direct;
     
     y += c->y_pos;                                  /* Set Y position */
     
@@ -445,141 +745,277 @@ draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_font
     
     if (GUI.ll.CopyChar != NULL) {                  /* If copying character function exists in low-level part */
         gui_font_charentry_t* entry = NULL;
+        const uint8_t* ptr = NULL;
+        gui_dim_t width, height, offlineSrc, offlineDst, tmpx, offset;
+        gui_dim_t stride = c->x_size;               /* Number of source pixels in single line */
+        gui_layer_t* layer;
+        uint8_t* dst = 0;
+        uint8_t a4 = 0;
         
-        entry = get_char_entry_from_font(font, c);  /* Get char entry from font and character for fast alpha drawing operations */
-        if (entry == NULL) {
-            entry = create_char_entry_from_font(font, c);   /* Create new entry */
-        }
-        if (entry != NULL) {                        /* We have valid data */
-            gui_dim_t width, height, offlineSrc, offlineDst, tmpx;
-            uint8_t* dst = 0;
-            uint8_t* ptr = (uint8_t *)entry;        /* Get pointer */
-            
-            tmpx = x;                               /* Start X */
-            
-            ptr += sizeof(*entry);                  /* Go to start of data array */
-            dst = (uint8_t *)(GUI.lcd.drawing_layer->start_address + ((y - GUI.lcd.drawing_layer->y_offset) * GUI.lcd.drawing_layer->width + (x - GUI.lcd.drawing_layer->x_offset)) * GUI.lcd.pixel_size);
-            
-            width = c->x_size;                      /* Get X size */
+        tmpx = GUI_MAX(x, disp->x1);                /* Start X of visible part */
+        width = GUI_MIN(x + c->x_size, disp->x2) - tmpx;    /* Visible width */
+        split = draw->x + draw->color1width;        /* First column drawn with second color */
+        
+        if (font->flags & GUI_FLAG_FONT_A8) {       /* Alpha data are ready in font */
+            ptr = c->data;
+        } else if ((font->flags & GUI_FLAG_FONT_A4) && GUI.ll.CopyCharA4 != NULL
+            && !((tmpx - x) & 0x01) && (split <= tmpx || split >= (tmpx + width) || !((split - x) & 0x01))) {
+            ptr = c->data;                          /* Copy 4-bit alpha from font when parts start on byte */
+            stride = (c->x_size + 1) & ~0x01;
+            a4 = 1;
+        } else if (font->flags & GUI_FLAG_FONT_A4) {
+            /*
+             * Parts start in the middle of byte, expand visible lines
+             * one by one to stack and copy each before line is reused
+             */
+            layer = GUI.lcd.drawing_layer;
+            x2 = tmpx + width;
+            y1 = GUI_MAX(y, disp->y1);
+            y2 = GUI_MIN(y + c->y_size, disp->y2);
+            guii_draw_flush();                      /* Keep order with pending operations */
+            for (row = y1; row < y2; row++) {
+                line = char_get_alpha_line(font, c, row - y, buff);
+                for (px = tmpx; px < x2; px = end) {
+                    end = px < split ? GUI_MIN(split, x2) : x2;
+                    dst = (uint8_t *)(layer->start_address + ((row - layer->y_offset) * layer->width + (px - layer->x_offset)) * GUI.lcd.pixel_size);
+                    GUI.ll.CopyChar(&GUI.lcd, layer, line + (px - x), dst, end - px, 1, 0, 0, px < split ? draw->color1 : draw->Color2);
+                }
+                guii_ll_wait();                     /* Line may still be read by queued copy operation */
+            }
+            return;
+        } else {
+            entry = get_char_entry_from_font(font, c);  /* Get char entry from font and character for fast alpha drawing operations */
+            if (entry == NULL) {
+                entry = create_char_entry_from_font(font, c);   /* Create new entry */
+            }
+            if (entry != NULL) {
+                ptr = CHAR_ENTRY_DATA(entry);       /* Get pointer to start of data array */
+            }
+        }
+        if (ptr != NULL) {                          /* We have valid data */
             height = c->y_size;                     /* Get Y size */
+            offset = tmpx - x;                      /* Offset of first visible pixel in source */
+            
+            dst = (uint8_t *)(GUI.lcd.drawing_layer->start_address + ((y - GUI.lcd.drawing_layer->y_offset) * GUI.lcd.drawing_layer->width + (tmpx - GUI.lcd.drawing_layer->x_offset)) * GUI.lcd.pixel_size);
             
             if (y < disp->y1) {                     /* Start Y position if outside visible area */
-                ptr += (disp->y1 - y) * c->x_size;  /* Set offset for number of lines */
+                offset += (disp->y1 - y) * stride;  /* Set offset for number of lines */
                 dst += (disp->y1 - y) * GUI.lcd.drawing_layer->width * GUI.lcd.pixel_size;  /* Set offset for number of LCD lines */
                 height -= disp->y1 - y;             /* Decrease effective height */
             }
             if ((y + c->y_size) > disp->y2) {
                 height -= y + c->y_size - disp->y2; /* Decrease effective height */
             }
-            if (x < disp->x1) {                     /* Set offset start address if required */
-                ptr += (disp->x1 - x);              /* Set offset of start address in X direction */
-                dst += (disp->x1 - x) * GUI.lcd.pixel_size; /* Set offset of start address in X direction */
-                width -= disp->x1 - x;              /* Increase source offline */
-                tmpx += disp->x1 - x;               /* Increase effective start X position */
-            }
-            if ((x + c->x_size) > disp->x2) {
-                width -= x + c->x_size - disp->x2;  /* Decrease effective width */
-            }
             
-            offlineSrc = c->x_size - width;         /* Set offline source */
+            offlineSrc = stride - width;            /* Set offline source */
             offlineDst = GUI.lcd.drawing_layer->width - width;   /* Set offline destination */
             
             /**
              * Check if character must be drawn with 2 colors, on the middle of color switch
              */
-            if (tmpx < (draw->x + draw->color1width) && (tmpx + width) > (draw->x + draw->color1width)) {
-                gui_dim_t firstWidth = (draw->x + draw->color1width) - tmpx;
+            if (tmpx < split && (tmpx + width) > split) {
+                gui_dim_t firstWidth = split - tmpx;
                 
                 /* First part draw */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, ptr, dst, 
+                draw_char_copy(ptr, a4, offset, dst, 
                     firstWidth, height,
                     offlineSrc + width - firstWidth, offlineDst + width - firstWidth, draw->color1);
                 
                 /* Second part draw */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, ptr + firstWidth, dst + firstWidth * GUI.lcd.pixel_size, 
+                draw_char_copy(ptr, a4, offset + firstWidth, dst + firstWidth * GUI.lcd.pixel_size, 
                     width - firstWidth, height,
                     offlineSrc + firstWidth, offlineDst + firstWidth, draw->Color2);
             } else {
                 /* Draw entire character with single color */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, ptr, dst, 
+                draw_char_copy(ptr, a4, offset, dst, 
                     width, height,
-                    offlineSrc, offlineDst, (draw->x + draw->color1width) > x ? draw->color1 : draw->Color2);
+                    offlineSrc, offlineDst, split > tmpx ? draw->color1 : draw->Color2);
             }
             return;
         }
     }
     
-    if (font->flags & GUI_FLAG_FONT_AA) {           /* Font has anti alliasing enabled */
-        gui_color_t color;                          /* Temporary color for AA */
-        uint8_t tmp, r1, g1, b1;
-        
-        columns = c->x_size / 4;                    /* Calculate number of bytes used for single character line */
-        if (c->x_size % 4) {                        /* If only 1 column used */
-            columns++;
+    /*
+     * Software fallback, decode each visible character line once
+     * and draw it as spans of pixels with equal alpha and color.
+     * Clipping and colors are the same as with character copy above
+     */
+    direct = (GUI.lcd.flags & GUI_FLAG_LCD_CPU_ACCESS) && (GUI.lcd.pixel_size == 4 || GUI.lcd.pixel_size == 2);
+    if (direct) {                                   /* CPU writes directly to layer memory */
+        guii_draw_flush();
+        guii_ll_wait();                             /* Wait for queued operations on layer */
+    }
+    x1 = GUI_MAX(x, disp->x1);                      /* Clip columns and rows */
+    x2 = GUI_MIN(x + c->x_size, disp->x2);
+    y1 = GUI_MAX(y, disp->y1);
+    y2 = GUI_MIN(y + c->y_size, disp->y2);
+    split = draw->x + draw->color1width;            /* First column drawn with second color */
+    for (row = y1; row < y2; row++) {
+        line = char_get_alpha_line(font, c, row - y, buff);
+        for (px = x1; px < x2; px = end) {
+            a = line[px - x];
+            for (end = px + 1; end < x2 && end != split && line[end - x] == a; end++) {}
+            if (a) {
+                draw_alpha_span(px, row, end - px, a, px < split ? draw->color1 : draw->Color2, direct);
+            }
         }
-        
-        for (i = 0; i < columns * c->y_size; i++) { /* Go through all data bytes */
-            if (y >= disp->y1 && y <= disp->y2 && y < (draw->y + draw->height)) {   /* Do not draw when we are outside clipping are */            
-                b = c->data[i];                     /* Get character byte */
-                for (k = 0; k < 4; k++) {           /* Scan each bit in byte */
-                    gui_color_t baseColor;
-                    x1 = x + (i % columns) * 4 + k; /* Get new X value for pixel draw */
-                    if (x1 < disp->x1 || x1 > disp->x2) {
-                        continue;
-                    }
-                    if (x1 < (draw->x + draw->color1width)) {
-                        baseColor = draw->color1;
-                    } else {
-                        baseColor = draw->Color2;
-                    }
-                    tmp = (b >> (6 - 2 * k)) & 0x03;/* Get temporary bits on bottom */
-                    if (tmp == 0x03) {              /* Draw solid color if both bits are enabled */
-                        gui_draw_setpixel(disp, x1, y, baseColor);
-                    } else if (tmp) {               /* Calculate new color */
-                        float t = (float)tmp / 3.0f;
-                        color = gui_draw_getpixel(disp, x1, y); /* Read current color */
-                        
-                        /* Calculate new values for pixel */
-                        r1 = (float)t * (float)((color >> 16) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >> 16) & 0xFF);
-                        g1 = (float)t * (float)((color >>  8) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >>  8) & 0xFF);
-                        b1 = (float)t * (float)((color >>  0) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >>  0) & 0xFF);
-                        
-                        /* Draw actual pixel to screen */
-                        gui_draw_setpixel(disp, x1, y, (color & 0xFF000000UL) | r1 << 16 | g1 << 8 | b1);
-                    }
-                }
+    }
+}
+
+/**
+ * \brief           Start composing visible part of text line to alpha only scratch buffer
+ * \param[out]      tl: Pointer to \ref gui_draw_textline_t structure for line
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       font: Pointer to \ref gui_font_t structure with used font
+ * \param[in]       draw: Pointer to \ref gui_draw_font_t structure with drawing colors
+ * \param[in]       x: X position of first character on line
+ * \param[in]       y: Y position of line
+ * \return          `1` when characters can be added to line, `0` when they must be drawn one by one
+ */
+static uint8_t
+textline_start(gui_draw_textline_t* tl, const gui_display_t* disp, const gui_font_t* font, const gui_draw_font_t* draw, gui_dim_t x, gui_dim_t y) {
+#if GUI_CFG_TEXT_LINE_BUFFER_SIZE
+    size_t size;
+    gui_dim_t x1, y1, y2;
+    
+    if (GUI.ll.CopyChar == NULL) {                  /* Composed line is drawn with alpha copy only */
+        return 0;
+    }
+    x1 = GUI_MAX(x, disp->x1);                      /* Get visible part of line */
+    y1 = GUI_MAX(y, disp->y1);
+    y2 = GUI_MIN(y + font->size, disp->y2);
+    if (x1 >= disp->x2 || y1 >= y2) {               /* Line is not visible */
+        return 0;
+    }
+    size = GUI_MEM_ALIGN((size_t)(disp->x2 - x1) * (size_t)(y2 - y1));
+    if (size > GUI_CFG_TEXT_LINE_BUFFER_SIZE) {     /* Line does not fit to buffer */
+        return 0;
+    }
+    if (GUI.TextLineBuff == NULL) {                 /* Allocate buffer on first use */
+        GUI.TextLineBuff = GUI_MEMALLOC_CLASS(GUI_CFG_TEXT_LINE_BUFFER_SIZE, GUI_MEM_CLASS_PIXEL);
+        if (GUI.TextLineBuff == NULL) {
+            return 0;
+        }
+        GUI.TextLinePos = 0;
+    }
+    if ((GUI.TextLinePos + size) > GUI_CFG_TEXT_LINE_BUFFER_SIZE) {
+        guii_draw_flush();                          /* Start of buffer may be used by pending operations */
+        guii_ll_wait();
+        GUI.TextLinePos = 0;
+    }
+    tl->buff = &GUI.TextLineBuff[GUI.TextLinePos];
+    GUI.TextLinePos += size;
+    tl->x1 = tl->x2 = x1;
+    tl->y1 = y1;
+    tl->y2 = y2;
+    tl->stride = disp->x2 - x1;
+    tl->disp = disp;
+    tl->draw = draw;
+    return 1;
+#else /* GUI_CFG_TEXT_LINE_BUFFER_SIZE */
+    return 0;
+#endif /* !GUI_CFG_TEXT_LINE_BUFFER_SIZE */
+}
+
+/**
+ * \brief           Draw composed part of text line with single alpha copy for each color
+ * \note            Characters added after this call are composed only after line is started again
+ * \param[in,out]   tl: Pointer to \ref gui_draw_textline_t structure for line
+ */
+static void
+textline_finish(gui_draw_textline_t* tl) {
+#if GUI_CFG_TEXT_LINE_BUFFER_SIZE
+    gui_dim_t x, xe, split, width;
+    uint8_t* dst;
+    
+    split = tl->draw->x + tl->draw->color1width;    /* First column drawn with second color */
+    for (x = tl->x1; x < tl->x2; x = xe) {
+        xe = x < split ? GUI_MIN(split, tl->x2) : tl->x2;
+        width = xe - x;
+        dst = (uint8_t *)(GUI.lcd.drawing_layer->start_address + ((tl->y1 - GUI.lcd.drawing_layer->y_offset) * GUI.lcd.drawing_layer->width + (x - GUI.lcd.drawing_layer->x_offset)) * GUI.lcd.pixel_size);
+        draw_copychar(tl->buff + (x - tl->x1), dst, width, tl->y2 - tl->y1,
+            tl->stride - width, GUI.lcd.drawing_layer->width - width, x < split ? tl->draw->color1 : tl->draw->Color2);
+    }
+    tl->x1 = tl->x2 = tl->disp->x2;                 /* Drawn part is not used anymore */
+#endif /* GUI_CFG_TEXT_LINE_BUFFER_SIZE */
+}
+
+/**
+ * \brief           Add character to composed text line
+ * \note            Characters must be added from left to right
+ * \param[in,out]   tl: Pointer to \ref gui_draw_textline_t structure for line
+ * \param[in]       font: Pointer to \ref gui_font_t structure with used font
+ * \param[in]       x: X position of character
+ * \param[in]       y: Y position of line
+ * \param[in]       c: Character to add
+ * \return          `1` when character is added, `0` when it must be drawn separatelly
+ */
+static uint8_t
+textline_add(gui_draw_textline_t* tl, const gui_font_t* font, gui_dim_t x, gui_dim_t y, const gui_font_char_t* c) {
+#if GUI_CFG_TEXT_LINE_BUFFER_SIZE
+    gui_font_charentry_t* entry;
+    const uint8_t* src;
+    const uint8_t* data;
+    uint8_t* dst;
+    gui_dim_t cx1, cx2, cy1, cy2, cy, row, col, stride;
+    
+    cy = y + c->y_pos;
+    cx1 = GUI_MAX(x, tl->disp->x1);                 /* Visible columns and rows of character */
+    cx2 = GUI_MIN(x + c->x_size, tl->disp->x2);
+    cy1 = GUI_MAX(cy, tl->disp->y1);
+    cy2 = GUI_MIN(cy + c->y_size, tl->disp->y2);
+    if (cx1 >= cx2 || cy1 >= cy2) {                 /* Character is not visible */
+        return 1;
+    }
+    data = NULL;
+    if (cy1 >= tl->y1 && cy2 <= tl->y2) {           /* Character must be inside line */
+        if (font->flags & (GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_A4)) {  /* Alpha data are read from font */
+            data = c->data;
+        } else {
+            entry = get_char_entry_from_font(font, c);
+            if (entry == NULL) {
+                entry = create_char_entry_from_font(font, c);
             }
-            if ((i % columns) == (columns - 1)) {   /* Check for next line */
-                y++;
+            if (entry != NULL) {
+                data = CHAR_ENTRY_DATA(entry);
             }
         }
-    } else {
-        columns = c->x_size / 8;
-        if (c->x_size % 8) {
-            columns++;
-        }
-        for (i = 0; i < columns * c->y_size; i++) { /* Go through all data bytes */
-            if (y >= disp->y1 && y <= disp->y2 && y < (draw->y + draw->height)) {   /* Do not draw when we are outside clipping are */
-                b = c->data[i];                     /* Get character byte */
-                for (k = 0; k < 8; k++) {           /* Scan each bit in byte */
-                    if (b & (1 << (7 - k))) {       /* If bit is set, draw pixel */
-                        x1 = x + (i % columns) * 8 + k; /* Get new X value for pixel draw */
-                        if (x1 < disp->x1 || x1 > disp->x2) {
-                            continue;
-                        }
-                        if (x1 <= (draw->x + draw->color1width)) {
-                            gui_draw_setpixel(disp, x1, y, draw->color1);
-                        } else {
-                            gui_draw_setpixel(disp, x1, y, draw->Color2);
-                        }
-                    }
+    }
+    if (data == NULL) {                             /* Character is drawn separatelly */
+        textline_finish(tl);                        /* Draw composed part first to keep drawing order */
+        return 0;
+    }
+    if (cx1 < tl->x2) {                             /* Character overlaps previous one or line is finished */
+        textline_finish(tl);
+        if (!textline_start(tl, tl->disp, font, tl->draw, cx1, y)) {
+            return 0;
+        }
+    }
+    
+    /* Clear area from previous character and copy visible character part */
+    stride = (font->flags & GUI_FLAG_FONT_A4) ? ((c->x_size + 1) >> 1) : c->x_size;
+    src = data + (cy1 - cy) * stride;
+    dst = tl->buff + (tl->x2 - tl->x1);
+    for (row = tl->y1; row < tl->y2; row++, dst += tl->stride) {
+        memset(dst, 0x00, cx1 - tl->x2);
+        if (row >= cy1 && row < cy2) {
+            if (font->flags & GUI_FLAG_FONT_A4) {   /* Expand 4-bit alpha directly to line */
+                for (col = cx1 - x; col < cx2 - x; col++) {
+                    dst[col + x - tl->x2] = CHAR_A4_ALPHA(src, 0, col);
                 }
+            } else {
+                memcpy(dst + (cx1 - tl->x2), src + (cx1 - x), cx2 - cx1);
             }
-            if ((i % columns) == (columns - 1)) {   /* Check for next line */
-                y++;
-            }
+            src += stride;
+        } else {
+            memset(dst + (cx1 - tl->x2), 0x00, cx2 - cx1);
         }
     }
+    tl->x2 = cx2;
+    return 1;
+#else /* GUI_CFG_TEXT_LINE_BUFFER_SIZE */
+    return 0;
+#endif /* !GUI_CFG_TEXT_LINE_BUFFER_SIZE */
 }
 
 /* Get string pointer start address for specific width of rectangle */
@@ -638,7 +1074,7 @@ gui_draw_fill(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t wid
         height = disp->y2 - y;
     }
     if (width > 0 && height > 0) {
-        GUI.ll.FillRect(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_offset, y - GUI.lcd.drawing_layer->y_offset, width, height, color);
+        draw_fillrect(x, y, width, height, color);
     }
 }
 
@@ -658,6 +1094,7 @@ gui_draw_font_init(gui_draw_font_t* f) {
  */
 void
 gui_draw_fillscreen(const gui_display_t* disp, gui_color_t color) {
+    guii_draw_flush();
     GUI.ll.Fill(&GUI.lcd, GUI.lcd.drawing_layer, 0, GUI.lcd.drawing_layer->width, GUI.lcd.drawing_layer->height, 0, color);
 }
 
@@ -674,6 +1111,7 @@ gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color
     if (y < disp->y1 || y >= disp->y2 || x < disp->x1 || x >= disp->x2) {
         return;
     }
+    guii_draw_flush();
     GUI.ll.SetPixel(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_offset, y - GUI.lcd.drawing_layer->y_offset, color);
 }
 
@@ -687,6 +1125,7 @@ gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color
  */
 gui_color_t
 gui_draw_getpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
+    guii_draw_flush();                              /* Pixel may be changed by pending batch */
     return GUI.ll.GetPixel(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_offset, y - GUI.lcd.drawing_layer->y_offset);
 }
 
@@ -711,7 +1150,7 @@ gui_draw_vline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t le
     if ((y + length) > disp->y2) {
         length = disp->y2 - y;
     }
-    GUI.ll.DrawVLine(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_offset, y - GUI.lcd.drawing_layer->y_offset, length, color);
+    draw_fillrect(x, y, 1, length, color);
 }
 
 /**
@@ -735,7 +1174,7 @@ gui_draw_hline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t le
     if ((x + length) > disp->x2) {
         length = disp->x2 - x;
     }
-    GUI.ll.DrawHLine(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_offset, y - GUI.lcd.drawing_layer->y_offset, length, color);
+    draw_fillrect(x, y, length, 1, color);
 }
 
 /******************************************************************************/
@@ -745,104 +1184,366 @@ gui_draw_hline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t le
 /******************************************************************************/
 
 /**
- * \brief           Draw line from point 1 to point 2
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x1: Line start X position
- * \param[in]       y1: Line start Y position
- * \param[in]       x2: Line end X position
- * \param[in]       y2: Line end Y position
+ * \brief           Draw single run of line pixels on major axis direction
+ * \note            Run must be already clipped to drawing region
+ * \param[in]       xmajor: Set to `1` when line has X as major axis, `0` otherwise
+ * \param[in]       a1: Run start position on major axis
+ * \param[in]       a2: Run end position on major axis, including pixel itself
+ * \param[in]       b: Position on minor axis
  * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_vline, gui_draw_hline
  */
-void
-gui_draw_line(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
-    gui_dim_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-    yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-    curpixel = 0;
-    
-    /* Check if coordinates are inside drawing region */
-//    if (                                            /* Check if redraw is inside area */
-//        !__GUI_RECT_MATCH(  x1, y1, x2, y2,
-//                            disp->x1, disp->y1, disp->x2, disp->y2)) {
-//        return;
-//    }
-
-	deltax = GUI_ABS(x2 - x1);
-	deltay = GUI_ABS(y2 - y1);
+static void
+draw_line_run(uint8_t xmajor, int32_t a1, int32_t a2, int32_t b, gui_color_t color) {
+    gui_dim_t a = (gui_dim_t)GUI_MIN(a1, a2);
+    gui_dim_t len = (gui_dim_t)(GUI_ABS(a2 - a1) + 1);
     
-    if (deltax == 0) {                              /* Straight vertical line */
-        gui_draw_vline(disp, x1, GUI_MIN(y1, y2), deltay, color);
-        return;
-    }
-    if (deltay == 0) {                              /* Straight horizontal line */
-        gui_draw_hline(disp, GUI_MIN(x1, x2), y1, deltax, color);
-        return;
+    if (xmajor) {                                   /* Horizontal run */
+        draw_fillrect(a, (gui_dim_t)b, len, 1, color);
+    } else {                                        /* Vertical run */
+        draw_fillrect((gui_dim_t)b, a, 1, len, color);
     }
+}
 
-    x = x1;
-    y = y1;
+/**
+ * \brief           Initialize span generator for filled shapes
+ * \param[out]      s: Pointer to \ref gui_draw_spans_t structure to initialize
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       color: Color used for drawing operation
+ */
+static void
+spans_init(gui_draw_spans_t* s, const gui_display_t* disp, gui_color_t color) {
+    s->disp = disp;
+    s->color = color;
+    s->x1 = s->x2 = 0;
+    s->y1 = s->y2 = 0;
+}
 
-    if (x2 >= x1) {
-        xinc1 = 1;
-        xinc2 = 1;
-    } else {
-        xinc1 = -1;
-        xinc2 = -1;
+/**
+ * \brief           Draw pending spans with single low-level call
+ * \param[in,out]   s: Pointer to \ref gui_draw_spans_t structure
+ */
+static void
+spans_flush(gui_draw_spans_t* s) {
+    if (s->y2 > s->y1) {
+        draw_fillrect(s->x1, s->y1, s->x2 - s->x1, s->y2 - s->y1, s->color);
+        s->y2 = s->y1;
     }
+}
 
-    if (y2 >= y1) {
-        yinc1 = 1;
-        yinc2 = 1;
-    } else {
-        yinc1 = -1;
-        yinc2 = -1;
+/**
+ * \brief           Add horizontal span of pixels to span generator
+ *
+ *                  Span is clipped to drawing region. When it continues pending spans
+ *                  on adjacent row with the same X start and end, rectangle is extended
+ *                  instead of drawing it immediately.
+ *
+ * \param[in,out]   s: Pointer to \ref gui_draw_spans_t structure
+ * \param[in]       y: Row of span
+ * \param[in]       x1: Span start X position
+ * \param[in]       x2: Span end X position, pixel itself is not included
+ */
+static void
+spans_add(gui_draw_spans_t* s, gui_dim_t y, gui_dim_t x1, gui_dim_t x2) {
+    if (y < s->disp->y1 || y >= s->disp->y2) {      /* Row is not visible */
+        return;
     }
-
-    if (deltax >= deltay) {
-        xinc1 = 0;
-        yinc2 = 0;
-        den = deltax;
-        num = deltax / 2;
-        numadd = deltay;
-        numpixels = deltax;
-    } else {
-        xinc2 = 0;
-        yinc1 = 0;
-        den = deltay;
-        num = deltay / 2;
-        numadd = deltax;
-        numpixels = deltay;
+    x1 = GUI_MAX(x1, s->disp->x1);
+    x2 = GUI_MIN(x2, s->disp->x2);
+    if (x1 >= x2) {
+        return;
     }
-
-    for (curpixel = 0; curpixel <= numpixels; curpixel++) {
-        gui_draw_setpixel(disp, x, y, color);
-        num += numadd;
-        if (num >= den) {
-            num -= den;
-            x += xinc1;
-            y += yinc1;
+    if (s->y2 > s->y1 && s->x1 == x1 && s->x2 == x2) {
+        if (y == s->y2) {                           /* Extend pending rectangle down */
+            s->y2++;
+            return;
+        } else if (y == (s->y1 - 1)) {              /* Extend pending rectangle up */
+            s->y1--;
+            return;
         }
-        x += xinc2;
-        y += yinc2;
     }
+    spans_flush(s);
+    s->x1 = x1;
+    s->x2 = x2;
+    s->y1 = y;
+    s->y2 = y + 1;
 }
 
 /**
- * \brief           Draw rectangle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: Top left X position
- * \param[in]       y: Top left Y position
- * \param[in]       width: Rectangle width
- * \param[in]       height: Rectangle height
- * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_filledrectangle, gui_draw_roundedrectangle, gui_draw_filledroundedrectangle
+ * \brief           Add spans of filled circle corners for single row offset from corner origin
+ * \param[in,out]   spans: Pointer to span generators for top and bottom corners
+ * \param[in]       xl: X position of left corners origin
+ * \param[in]       xr: X position of right corners origin
+ * \param[in]       yt: Y position of top corners origin
+ * \param[in]       yb: Y position of bottom corners origin
+ * \param[in]       d: Row offset from corner origin
+ * \param[in]       w: Width of corner on this row
+ * \param[in]       c: List of corners to draw
  */
-void
-gui_draw_rectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
-    if (width == 0 || height == 0) {
+static void
+spans_add_corner(gui_draw_spans_t* spans, gui_dim_t xl, gui_dim_t xr, gui_dim_t yt, gui_dim_t yb, gui_dim_t d, gui_dim_t w, uint8_t c) {
+    if (w <= 0) {
         return;
     }
-    gui_draw_hline(disp, x,             y,              width,  color);
+    if (c & (GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR)) {    /* Top corners are merged to single span */
+        spans_add(&spans[0], yt - d, (c & GUI_DRAW_CIRCLE_TL) ? xl - w : xr, (c & GUI_DRAW_CIRCLE_TR) ? xr + w : xl);
+    }
+    if (c & (GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR)) {    /* Bottom corners are merged to single span */
+        spans_add(&spans[1], yb + d, (c & GUI_DRAW_CIRCLE_BL) ? xl - w : xr, (c & GUI_DRAW_CIRCLE_BR) ? xr + w : xl);
+    }
+}
+
+/**
+ * \brief           Draw filled circle corners with spans
+ *
+ *                  Top corners have origin at `yt` and bottom corners at `yb`.
+ *                  When left and right corners are drawn together, pixels between `xl` and `xr` are drawn too.
+ *                  Drawn pixels are the same as with separate horizontal lines of midpoint circle algorithm.
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       xl: X position of left corners origin
+ * \param[in]       xr: X position of right corners origin
+ * \param[in]       yt: Y position of top corners origin
+ * \param[in]       yb: Y position of bottom corners origin
+ * \param[in]       r: Circle radius
+ * \param[in]       c: List of corners to draw
+ * \param[in]       color: Color used for drawing operation
+ */
+static void
+draw_filledcorners(const gui_display_t* disp, gui_dim_t xl, gui_dim_t xr, gui_dim_t yt, gui_dim_t yb, gui_dim_t r, uint8_t c, gui_color_t color) {
+    gui_draw_spans_t spans[4];                      /* Spans for rows around octant edge and rows around octant center */
+    gui_dim_t f = 1 - r;
+    gui_dim_t ddF_x = 1;
+    gui_dim_t ddF_y = -2 * r;
+    gui_dim_t x = 0;
+    gui_dim_t y = r;
+    gui_dim_t ay = -1, ax = 0;                      /* Pending row on octant edge and its width */
+    
+    if (!(c & (GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_BL))) {
+        xl = xr;
+    }
+    if (!(c & (GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BR))) {
+        xr = xl;
+    }
+    
+    /* Reject corners outside drawing region before rasterization */
+    if ((xl - r) >= disp->x2 || (xr + r) < disp->x1) {
+        return;
+    }
+    if (!(c & (GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR)) || (yt - r) >= disp->y2 || yt < disp->y1) {
+        c &= ~(GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR);
+    }
+    if (!(c & (GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR)) || yb >= disp->y2 || (yb + r) < disp->y1) {
+        c &= ~(GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR);
+    }
+    if (!c) {
+        return;
+    }
+    
+    spans_init(&spans[0], disp, color);
+    spans_init(&spans[1], disp, color);
+    spans_init(&spans[2], disp, color);
+    spans_init(&spans[3], disp, color);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        
+        /*
+         * Row at offset y has width x and row at offset x has width y.
+         * Row at offset y is the same for multiple steps, draw it only with last, the widest, x.
+         */
+        if (y != ay) {
+            spans_add_corner(&spans[0], xl, xr, yt, yb, ay, ax, c);
+            ay = y;
+        }
+        ax = x;
+        spans_add_corner(&spans[2], xl, xr, yt, yb, x, y, c);
+    }
+    spans_add_corner(&spans[0], xl, xr, yt, yb, ay, ax, c);
+    
+    spans_flush(&spans[0]);
+    spans_flush(&spans[1]);
+    spans_flush(&spans[2]);
+    spans_flush(&spans[3]);
+}
+
+/**
+ * \brief           Get horizontal range of triangle edge on single row
+ * \param[in]       y: Row to get range on
+ * \param[in]       xa: Edge start X position
+ * \param[in]       ya: Edge start Y position
+ * \param[in]       xb: Edge end X position
+ * \param[in]       yb: Edge end Y position, must not be smaller than `ya`
+ * \param[in,out]   x1: Pointer to minimal X of row, updated when edge is on the left
+ * \param[in,out]   x2: Pointer to maximal X of row, updated when edge is on the right
+ */
+static void
+triangle_edge_range(int32_t y, int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t* x1, int32_t* x2) {
+    int32_t dx, dy, t1, t2, xs, xe;
+    
+    if (y < ya || y > yb) {                         /* Edge is not on this row */
+        return;
+    }
+    dx = xb - xa;
+    dy = yb - ya;
+    if (dy == 0) {                                  /* Horizontal edge */
+        xs = GUI_MIN(xa, xb);
+        xe = GUI_MAX(xa, xb);
+    } else {
+        /* Edge covers pixels between half rows above and below, rounded to nearest pixel */
+        t1 = GUI_MAX(2 * (y - ya) - 1, 0) * dx;
+        t2 = GUI_MIN(2 * (y - ya) + 1, 2 * dy) * dx;
+        xs = xa + (t1 >= 0 ? (t1 + dy) / (2 * dy) : -((dy - t1) / (2 * dy)));
+        xe = xa + (t2 >= 0 ? (t2 + dy) / (2 * dy) : -((dy - t2) / (2 * dy)));
+        if (xs > xe) {
+            t1 = xs;
+            xs = xe;
+            xe = t1;
+        }
+    }
+    *x1 = GUI_MIN(*x1, xs);
+    *x2 = GUI_MAX(*x2, xe);
+}
+
+/**
+ * \brief           Draw line from point 1 to point 2
+ *
+ *                  Line is clipped to drawing region before rasterization
+ *                  and pixels with the same position on minor axis are drawn as single horizontal or vertical line.
+ *                  Drawn pixels are the same as with Bresenham algorithm over whole line.
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x1: Line start X position
+ * \param[in]       y1: Line start Y position
+ * \param[in]       x2: Line end X position
+ * \param[in]       y2: Line end Y position
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_vline, gui_draw_hline
+ */
+void
+gui_draw_line(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
+    int32_t a1, b1, da, db, sa, sb;                 /* Start, delta and step on major and minor axis */
+    int32_t amin, amax, bmin, bmax;                 /* Clipping region on major and minor axis */
+    int32_t i, istart, iend, num, b, run;
+    uint8_t xmajor;
+    gui_dim_t deltax, deltay;
+    
+	deltax = GUI_ABS(x2 - x1);
+	deltay = GUI_ABS(y2 - y1);
+    
+    if (deltax == 0) {                              /* Straight vertical line */
+        gui_draw_vline(disp, x1, GUI_MIN(y1, y2), deltay, color);
+        return;
+    }
+    if (deltay == 0) {                              /* Straight horizontal line */
+        gui_draw_hline(disp, GUI_MIN(x1, x2), y1, deltax, color);
+        return;
+    }
+    
+    /* Line is completely on one side of drawing region */
+    if (GUI_MAX(x1, x2) < disp->x1 || GUI_MIN(x1, x2) >= disp->x2 ||
+        GUI_MAX(y1, y2) < disp->y1 || GUI_MIN(y1, y2) >= disp->y2) {
+        return;
+    }
+    
+    xmajor = deltax >= deltay;
+    if (xmajor) {
+        a1 = x1;
+        b1 = y1;
+        da = deltax;
+        db = deltay;
+        sa = x2 >= x1 ? 1 : -1;
+        sb = y2 >= y1 ? 1 : -1;
+        amin = disp->x1;
+        amax = disp->x2 - 1;
+        bmin = disp->y1;
+        bmax = disp->y2 - 1;
+    } else {
+        a1 = y1;
+        b1 = x1;
+        da = deltay;
+        db = deltax;
+        sa = y2 >= y1 ? 1 : -1;
+        sb = x2 >= x1 ? 1 : -1;
+        amin = disp->y1;
+        amax = disp->y2 - 1;
+        bmin = disp->x1;
+        bmax = disp->x2 - 1;
+    }
+    
+    /*
+     * Pixel at step i is at major position a1 + sa * i
+     * and minor position b1 + sb * k, where k = (da / 2 + i * db) / da.
+     * Clip range of steps with both axes.
+     */
+    istart = 0;
+    iend = da;
+    if (sa > 0) {                                   /* Clip with major axis */
+        istart = GUI_MAX(istart, amin - a1);
+        iend = GUI_MIN(iend, amax - a1);
+    } else {
+        istart = GUI_MAX(istart, a1 - amax);
+        iend = GUI_MIN(iend, a1 - amin);
+    }
+    if (sb > 0) {                                   /* Minimal and maximal value of k on minor axis */
+        bmin -= b1;
+        bmax -= b1;
+    } else {
+        run = bmin;
+        bmin = b1 - bmax;
+        bmax = b1 - run;
+    }
+    if (bmax < 0) {                                 /* Minor axis never enters region */
+        return;
+    }
+    if (bmin > 0) {                                 /* First step where k >= bmin */
+        istart = GUI_MAX(istart, (bmin * da - da / 2 + db - 1) / db);
+    }
+    iend = GUI_MIN(iend, ((bmax + 1) * da - da / 2 - 1) / db);  /* Last step where k <= bmax */
+    if (istart > iend) {
+        return;
+    }
+    
+    /* Draw runs of pixels with the same minor position */
+    num = da / 2 + istart * db;
+    b = b1 + sb * (num / da);
+    num %= da;
+    run = a1 + sa * istart;                         /* Start of current run */
+    for (i = istart; i <= iend; i++) {
+        num += db;
+        if (num >= da) {                            /* Minor position changes after this pixel */
+            num -= da;
+            draw_line_run(xmajor, run, a1 + sa * i, b, color);
+            run = a1 + sa * (i + 1);
+            b += sb;
+        }
+    }
+    if (run != a1 + sa * (iend + 1)) {              /* Draw last run */
+        draw_line_run(xmajor, run, a1 + sa * iend, b, color);
+    }
+}
+
+/**
+ * \brief           Draw rectangle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_filledrectangle, gui_draw_roundedrectangle, gui_draw_filledroundedrectangle
+ */
+void
+gui_draw_rectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    if (width == 0 || height == 0) {
+        return;
+    }
+    gui_draw_hline(disp, x,             y,              width,  color);
     gui_draw_vline(disp, x,             y,              height, color);
     
     gui_draw_hline(disp, x,             y + height - 1, width,  color);
@@ -948,19 +1649,15 @@ gui_draw_filledroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_
     if (r >= (width / 2)) {
         r = width / 2 - 1;
     }
-    if (r) {
-        if ((gui_dim_t)(width - 2 * r) > 0) {
-            gui_draw_filledrectangle(disp, x + r,         y,     width - 2 * r, height,         color);
-        }
-        if ((gui_dim_t)(height - 2 * r) > 0) {
-            gui_draw_filledrectangle(disp, x,             y + r, r,             height - 2 * r, color);
-            gui_draw_filledrectangle(disp, x + width - r, y + r, r,             height - 2 * r, color);
+    if (r > 0) {
+        gui_draw_fill(disp, x, y + r, width, height - 2 * r, color);    /* Rows between corners */
+        if (r == 1) {                               /* Corners are single pixels */
+            gui_draw_fill(disp, x + 1, y,              width - 2, 1, color);
+            gui_draw_fill(disp, x + 1, y + height - 1, width - 2, 1, color);
+        } else {
+            draw_filledcorners(disp, x + r, x + width - r - 1, y + r, y + height - r - 1, r,
+                GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR, color);
         }
-        
-        gui_draw_filledcirclecorner(disp, x + r,             y + r,              r, GUI_DRAW_CIRCLE_TL, color);
-        gui_draw_filledcirclecorner(disp, x + width - r - 1, y + r,              r, GUI_DRAW_CIRCLE_TR, color);
-        gui_draw_filledcirclecorner(disp, x + r,             y + height - r - 1, r, GUI_DRAW_CIRCLE_BL, color);
-        gui_draw_filledcirclecorner(disp, x + width - r - 1, y + height - r - 1, r, GUI_DRAW_CIRCLE_BR, color);
     } else {
         gui_draw_filledrectangle(disp, x, y, width, height, color);
     }
@@ -994,10 +1691,8 @@ gui_draw_circle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t r
  */
 void
 gui_draw_filledcircle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t r, gui_color_t color) {
-    gui_draw_filledcirclecorner(disp, x, y, r, GUI_DRAW_CIRCLE_TL, color);
-    gui_draw_filledcirclecorner(disp, x, y, r, GUI_DRAW_CIRCLE_TR, color);
-    gui_draw_filledcirclecorner(disp, x, y - 1, r, GUI_DRAW_CIRCLE_BL, color);
-    gui_draw_filledcirclecorner(disp, x, y - 1, r, GUI_DRAW_CIRCLE_BR, color);
+    draw_filledcorners(disp, x, x, y, y - 1, r,
+        GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR, color);
 }
 
 /**
@@ -1033,59 +1728,47 @@ gui_draw_triangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1,  gui_di
  */
 void
 gui_draw_filledtriangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color) {
-    gui_dim_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-    yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-    curpixel = 0;
-
-    deltax = GUI_ABS(x2 - x1);
-    deltay = GUI_ABS(y2 - y1);
-    x = x1;
-    y = y1;
-
-    if (x2 >= x1) {
-        xinc1 = 1;
-        xinc2 = 1;
-    } else {
-        xinc1 = -1;
-        xinc2 = -1;
+    gui_draw_spans_t spans;
+    gui_dim_t tmp;
+    int32_t y, ystart, yend, xs, xe;
+    
+    /* Sort points by Y position */
+    if (y1 > y2) {
+        tmp = x1; x1 = x2; x2 = tmp;
+        tmp = y1; y1 = y2; y2 = tmp;
     }
-
-    if (y2 >= y1) {
-        yinc1 = 1;
-        yinc2 = 1;
-    } else {
-        yinc1 = -1;
-        yinc2 = -1;
+    if (y2 > y3) {
+        tmp = x2; x2 = x3; x3 = tmp;
+        tmp = y2; y2 = y3; y3 = tmp;
     }
-
-    if (deltax >= deltay){
-        xinc1 = 0;
-        yinc2 = 0;
-        den = deltax;
-        num = deltax / 2;
-        numadd = deltay;
-        numpixels = deltax;
-    } else {
-        xinc2 = 0;
-        yinc1 = 0;
-        den = deltay;
-        num = deltay / 2;
-        numadd = deltax;
-        numpixels = deltay;
+    if (y1 > y2) {
+        tmp = x1; x1 = x2; x2 = tmp;
+        tmp = y1; y1 = y2; y2 = tmp;
     }
-
-    for (curpixel = 0; curpixel <= numpixels; curpixel++) {
-        gui_draw_line(disp, x, y, x3, y3, color);
-
-        num += numadd;
-        if (num >= den) {
-            num -= den;
-            x += xinc1;
-            y += yinc1;
+    
+    /* Check if triangle is inside drawing region */
+    if (GUI_MAX(GUI_MAX(x1, x2), x3) < disp->x1 || GUI_MIN(GUI_MIN(x1, x2), x3) >= disp->x2 ||
+        y3 < disp->y1 || y1 >= disp->y2) {
+        return;
+    }
+    
+    /* Process visible rows only */
+    ystart = GUI_MAX(y1, disp->y1);
+    yend = GUI_MIN(y3, disp->y2 - 1);
+    spans_init(&spans, disp, color);
+    for (y = ystart; y <= yend; y++) {
+        xs = 0x7FFFFFFF;
+        xe = -0x7FFFFFFF;
+        triangle_edge_range(y, x1, y1, x3, y3, &xs, &xe);
+        triangle_edge_range(y, x1, y1, x2, y2, &xs, &xe);
+        triangle_edge_range(y, x2, y2, x3, y3, &xs, &xe);
+        if (xs <= xe) {
+            xs = GUI_MAX(xs, disp->x1);
+            xe = GUI_MIN(xe, disp->x2 - 1);
+            spans_add(&spans, (gui_dim_t)y, (gui_dim_t)xs, (gui_dim_t)(xe + 1));
         }
-        x += xinc2;
-        y += yinc2;
     }
+    spans_flush(&spans);
 }
 
 /**
@@ -1165,50 +1848,191 @@ gui_draw_circlecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui
  */
 void
 gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color) {
-    gui_dim_t f = 1 - r;
-    gui_dim_t ddF_x = 1;
-    gui_dim_t ddF_y = -2 * r;
-    gui_dim_t x = 0;
-    gui_dim_t y = r;
+    draw_filledcorners(disp, x0, x0, y0, y0, r, c, color);
+}
+
+/**
+ * \brief           Send image data to low-level driver
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       src: Pointer to first pixel of source data
+ * \param[in]       dst: Destination address in drawing layer
+ * \param[in]       width: Area width
+ * \param[in]       height: Area height
+ * \param[in]       offlinesrc: Number of pixels to skip in source after each line
+ * \param[in]       offlinedst: Number of pixels to skip in destination after each line
+ */
+static void
+draw_image_data(const gui_image_desc_t* img, const uint8_t* src, uint8_t* dst, gui_dim_t width, gui_dim_t height, gui_dim_t offlinesrc, gui_dim_t offlinedst) {
+    uint8_t bytes = img->bpp >> 3;                  /* Get number of bytes per pixel on image */
     
-    if (!__GUI_RECT_MATCH(
-        disp->x1, disp->y1, disp->x2, disp->y2,
-        x0 - r, y0 - r, x0 + r, y0 + r
-    )) {
-        return;
+    if (bytes == 4) {                               /* Draw 32BPP image */
+        if (GUI.ll.DrawImage32) {                   /* Draw image 32BPP if possible */
+            GUI.ll.DrawImage32(&GUI.lcd, GUI.lcd.drawing_layer, img, src, dst, width, height, offlinesrc, offlinedst);
+        }
+    } else if (bytes == 3) {                        /* Draw 24BPP image */
+        if (GUI.ll.DrawImage24) {                   /* Draw image 24BPP if possible */
+            GUI.ll.DrawImage24(&GUI.lcd, GUI.lcd.drawing_layer, img, src, dst, width, height, offlinesrc, offlinedst);
+        }
+    } else if (bytes == 2) {                        /* Draw 16BPP image */
+        if (GUI.ll.DrawImage16) {                   /* Draw image 16BPP if possible */
+            GUI.ll.DrawImage16(&GUI.lcd, GUI.lcd.drawing_layer, img, src, dst, width, height, offlinesrc, offlinedst);
+        }
+    } else if (img->bpp == 8 || img->bpp == 4) {    /* Draw L8 or L4 image with palette */
+        if (GUI.ll.DrawImageIndexed) {              /* Draw indexed image if possible */
+            GUI.ll.DrawImageIndexed(&GUI.lcd, GUI.lcd.drawing_layer, img, src, dst, width, height, offlinesrc, offlinedst);
+        }
     }
+}
 
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
+/**
+ * \brief           Decode part of single line of run-length encoded image
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       row: Line number in image
+ * \param[in]       col: First decoded column
+ * \param[in]       width: Number of decoded pixels
+ * \param[out]      out: Output buffer for decoded pixels
+ */
+static void
+image_rle_decode_line(const gui_image_desc_t* img, gui_dim_t row, gui_dim_t col, gui_dim_t width, uint8_t* out) {
+    uint8_t bytes = img->bpp >> 3;
+    const uint8_t* p = &img->image[4 * row];        /* Get line offset from index table */
+    gui_dim_t x, cnt, skip, n;
+    uint8_t repeat;
+    
+    p = img->image + ((uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24);
+    for (x = 0; width > 0; x += cnt) {
+        cnt = (*p & 0x7F) + 1;                      /* Get number of pixels in packet */
+        repeat = *p++ & 0x80;
+        if ((x + cnt) > col) {                      /* Packet is at least partially visible */
+            skip = col > x ? col - x : 0;
+            n = GUI_MIN(cnt - skip, width);
+            width -= n;
+            if (repeat) {                           /* Repeat single pixel, double copied part each step */
+                size_t done = bytes, total = (size_t)n * bytes;
+                memcpy(out, p, bytes);
+                for (; done < total; done <<= 1) {
+                    memcpy(out + done, out, GUI_MIN(done, total - done));
+                }
+                out += total;
+            } else {
+                memcpy(out, p + skip * bytes, n * bytes);
+                out += n * bytes;
+            }
         }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
+        p += repeat ? bytes : cnt * bytes;          /* Go to next packet */
+    }
+}
 
-        if (c & GUI_DRAW_CIRCLE_TL) {               /* Top left */            
-            gui_draw_hline(disp, x0 - x, y0 - y, x, color);
-            gui_draw_hline(disp, x0 - y, y0 - x, y, color);
+/**
+ * \brief           Decode part of single line of L4 image to L8 indexes
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       row: Line number in image
+ * \param[in]       col: First decoded column
+ * \param[in]       width: Number of decoded pixels
+ * \param[out]      out: Output buffer for decoded pixels
+ */
+static void
+image_l4_decode_line(const gui_image_desc_t* img, gui_dim_t row, gui_dim_t col, gui_dim_t width, uint8_t* out) {
+    const uint8_t* p = &img->image[row * ((img->x_size + 1) >> 1)];
+    
+    for (; width > 0; width--, col++) {
+        *out++ = (col & 0x01) ? (p[col >> 1] >> 4) : (p[col >> 1] & 0x0F);
+    }
+}
+
+/**
+ * \brief           Draw visible part of image, decoded line by line to decode buffer
+ * \note            Used for run-length encoded images and for L4 images starting on odd column.
+ *                      Buffer is kept for next images, driver may still read it when function returns
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       col: First visible column of image
+ * \param[in]       row: First visible line of image
+ * \param[in]       dst: Destination address in drawing layer
+ * \param[in]       width: Visible width
+ * \param[in]       height: Visible height
+ * \param[in]       offlinedst: Number of pixels to skip in destination after each line
+ */
+static void
+draw_image_decoded(const gui_image_desc_t* img, gui_dim_t col, gui_dim_t row, uint8_t* dst, gui_dim_t width, gui_dim_t height, gui_dim_t offlinedst) {
+    gui_image_desc_t out = *img;                    /* Description of decoded lines */
+    size_t linesize, size;
+    gui_dim_t lines, r, i, n;
+    uint8_t* buff;
+    
+    if (out.bpp == 4) {                             /* L4 is decoded to L8 indexes */
+        out.bpp = 8;
+    }
+    out.flags &= ~GUI_IMAGE_FLAG_RLE;
+    linesize = (size_t)width * (out.bpp >> 3);
+    if (GUI.ImageDecodeSize < linesize) {           /* Allocate buffer on first use or when line does not fit */
+        if (GUI.ImageDecodeBuff != NULL) {
+            guii_ll_wait();                         /* Buffer may still be used by previous image */
+            GUI_MEMFREE(GUI.ImageDecodeBuff);
+        }
+        size = GUI_MAX(GUI_CFG_IMAGE_DECODE_BUFFER_SIZE, linesize);
+        if ((buff = GUI_MEMALLOC_CLASS(size, GUI_MEM_CLASS_PIXEL)) == NULL && size > linesize) {
+            size = linesize;                        /* Try with single line only */
+            buff = GUI_MEMALLOC_CLASS(size, GUI_MEM_CLASS_PIXEL);
         }
-        if (c & GUI_DRAW_CIRCLE_TR) {               /* Top right */
-            gui_draw_hline(disp, x0, y0 - y, x, color);
-            gui_draw_hline(disp, x0, y0 - x, y, color);
+        GUI.ImageDecodeBuff = buff;
+        GUI.ImageDecodeSize = buff != NULL ? size : 0;
+        if (buff == NULL) {                         /* Not enough memory for single line */
+            return;
         }
-        if (c & GUI_DRAW_CIRCLE_BL) {               /* Bottom left */
-            gui_draw_hline(disp, x0 - y, y0 + x, y, color);
-            gui_draw_hline(disp, x0 - x, y0 + y, x, color);
+    }
+    buff = GUI.ImageDecodeBuff;
+    lines = GUI.ImageDecodeSize / linesize;         /* Number of lines decoded at a time */
+    lines = GUI_MAX(GUI_MIN(lines, height), 1);
+    for (r = 0; r < height; r += n) {
+        n = GUI_MIN(lines, height - r);
+        guii_ll_wait();                             /* Buffer may still be used by previous operation */
+        for (i = 0; i < n; i++) {
+            if (img->flags & GUI_IMAGE_FLAG_RLE) {
+                image_rle_decode_line(img, row + r + i, col, width, &buff[i * linesize]);
+            } else {
+                image_l4_decode_line(img, row + r + i, col, width, &buff[i * linesize]);
+            }
         }
-        if (c & GUI_DRAW_CIRCLE_BR) {               /* Bottom right */
-            gui_draw_hline(disp, x0, y0 + x, y, color);
-            gui_draw_hline(disp, x0, y0 + y, x, color);
+        draw_image_data(&out, buff, dst, width, n, 0, offlinedst);
+        dst += n * (width + offlinedst) * GUI.lcd.pixel_size;
+    }
+}
+
+/**
+ * \brief           Draw visible part of image line by line, limited to \ref gui_image_desc_t.rows
+ * \note            Consecutive lines with equal visible part are drawn with single call
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       col: First visible column of image
+ * \param[in]       row: First visible line of image
+ * \param[in]       dst: Destination address in drawing layer
+ * \param[in]       width: Visible width
+ * \param[in]       height: Visible height
+ * \param[in]       offlinedst: Number of pixels to skip in destination after each line
+ */
+static void
+draw_image_rows(const gui_image_desc_t* img, gui_dim_t col, gui_dim_t row, uint8_t* dst, gui_dim_t width, gui_dim_t height, gui_dim_t offlinedst) {
+    uint8_t bytes = img->bpp >> 3;
+    const gui_image_row_t* line;
+    gui_dim_t r, n, x1, x2, stride = width + offlinedst;
+    
+    for (r = 0; r < height; r += n) {
+        line = &img->rows[row + r];
+        for (n = 1; (r + n) < height && line[n].x1 == line->x1 && line[n].x2 == line->x2; n++);
+        x1 = GUI_MAX((gui_dim_t)line->x1, col);     /* Clip visible part of line */
+        x2 = GUI_MIN((gui_dim_t)line->x2, col + width);
+        if (x1 < x2) {
+            draw_image_data(img, img->image + ((row + r) * img->x_size + x1) * bytes,
+                dst + (r * stride + x1 - col) * GUI.lcd.pixel_size, x2 - x1, n, img->x_size - (x2 - x1), stride - (x2 - x1));
         }
     }
 }
 
 /**
  * \brief           Draw image to display of any depth and size
+ * \note            Only visible part of compressed \ref GUI_IMAGE_FLAG_RLE image is decoded.
+ *                      Compressed images with less than 8 bits per pixel are not drawn
+ *                      Images with 8 or 4 bits per pixel use \ref gui_image_desc_t.palette
+ *                      Only visible part of each line is drawn when \ref gui_image_desc_t.rows is set
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
  * \param[in]       x: Top left X position
  * \param[in]       y: Top left Y position
@@ -1216,46 +2040,48 @@ gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y
  */
 void
 gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img) {
-    uint8_t bytes = img->bpp >> 3;                  /* Get number of bytes per pixel on image */
+    uint8_t bytes;
     
     gui_layer_t* layer;
     const uint8_t* src;
-    const uint8_t* dst;
-    gui_dim_t width, height;
+    uint8_t* dst;
+    gui_dim_t width, height, col = 0, row = 0;
     gui_dim_t offlineSrc, offlineDst;
     
-    if (!img || !__GUI_RECT_MATCH(
+    if (!img || ((img->flags & GUI_IMAGE_FLAG_RLE) && img->bpp < 8) || !__GUI_RECT_MATCH(
         disp->x1, disp->y1, disp->x2, disp->y2,
         x, y, x + img->x_size, y + img->y_size
-    )) {
+    )) {                                            /* Run-length encoding has no format for pixels smaller than byte */
         return;
     }
     
+    bytes = img->bpp >> 3;                          /* Get number of bytes per pixel on image */
     layer = GUI.lcd.drawing_layer;                  /* Set layer pointer */
     
     width = img->x_size;                            /* Set default width */
     height = img->y_size;                           /* Set default height */
     
-    src = (uint8_t *)(img->image);                  /* Set source address */
     dst = (uint8_t *)(layer->start_address + GUI.lcd.pixel_size * ((y - layer->y_offset) * layer->width + (x - layer->x_offset)));
     
-    //TODO: Check proper coordinates for memory!
     if (y < disp->y1) {
-        src += (disp->y1 - y) * img->x_size * bytes;/* Set offset for number of image lines */
-        dst += (disp->y1 - y) * GUI.lcd.width * GUI.lcd.pixel_size;  /* Set offset for number of LCD lines */
-        height -= disp->y1 - y;                     /* Decrease effective height */
+        row = disp->y1 - y;                         /* Set first visible image line */
+        dst += row * layer->width * GUI.lcd.pixel_size; /* Set offset for number of layer lines */
+        height -= row;                              /* Decrease effective height */
     }
     if ((y + img->y_size) > disp->y2) {
         height -= y + img->y_size - disp->y2;       /* Decrease effective height */
     }
     if (x < disp->x1) {                             /* Set offset start address if required */
-        src += (disp->x1 - x) * bytes;              /* Set offset of start address in X direction */
-        dst += (disp->x1 - x) * GUI.lcd.pixel_size; /* Set offset of start address in X direction */
-        width -= disp->x1 - x;                      /* Decrease effective width */
+        col = disp->x1 - x;                         /* Set first visible image column */
+        dst += col * GUI.lcd.pixel_size;            /* Set offset of start address in X direction */
+        width -= col;                               /* Decrease effective width */
     }
     if ((x + img->x_size) > disp->x2) {
         width -= x + img->x_size - disp->x2;        /* Decrease effective width */
     }
+    if (width <= 0 || height <= 0) {
+        return;
+    }
     
     offlineSrc = img->x_size - width;               /* Set offline source */
     offlineDst = layer->width - width;              /* Set offline destination */
@@ -1263,18 +2089,18 @@ gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_de
     /*******************/
     /*    Draw image   */
     /*******************/
-    if (bytes == 4) {                               /* Draw 32BPP image */
-        if (GUI.ll.DrawImage32) {                   /* Draw image 32BPP if possible */
-            GUI.ll.DrawImage32(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)src, (uint8_t *)dst, width, height, offlineSrc, offlineDst);
-        }
-    } else if (bytes == 3) {                        /* Draw 24BPP image */
-        if (GUI.ll.DrawImage24) {                   /* Draw image 24BPP if possible */
-            GUI.ll.DrawImage24(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)src, (uint8_t *)dst, width, height, offlineSrc, offlineDst);
-        }
-    } else if (bytes == 2) {                        /* Draw 16BPP image */
-        if (GUI.ll.DrawImage16) {                   /* Draw image 16BPP if possible */
-            GUI.ll.DrawImage16(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)src, (uint8_t *)dst, width, height, offlineSrc, offlineDst);
-        }
+    guii_draw_flush();                              /* Images are not batched, keep drawing order */
+    if ((img->flags & GUI_IMAGE_FLAG_RLE) || (img->bpp == 4 && (col & 0x01))) {
+        draw_image_decoded(img, col, row, dst, width, height, offlineDst);  /* Decode only visible part */
+    } else if (img->bpp == 4) {                     /* L4 image, lines start on new byte */
+        src = img->image + row * ((img->x_size + 1) >> 1) + (col >> 1); /* Set source address */
+        offlineSrc = ((img->x_size + 1) & ~0x01) - width;   /* Set offline source in units of pixels */
+        draw_image_data(img, src, dst, width, height, offlineSrc, offlineDst);
+    } else if (img->rows != NULL) {                 /* Skip transparent part of each line */
+        draw_image_rows(img, col, row, dst, width, height, offlineDst);
+    } else {
+        src = img->image + (row * img->x_size + col) * bytes;   /* Set source address */
+        draw_image_data(img, src, dst, width, height, offlineSrc, offlineDst);
     }
 }
 
@@ -1303,8 +2129,352 @@ gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t l
     }
 }
 
+/**
+ * \brief           Draw filled polygon
+ *
+ *                  Polygon is filled with scanline algorithm and list of active edges.
+ *                  Edges are stepped from row to row with exact integer arithmetic
+ *                  and only rows and edges inside drawing region are processed.
+ *                  Pixel is drawn when its center is inside polygon, therefore
+ *                  right and bottom edges are not included, the same as with filled rectangle.
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       points: Pointer to array of \ref gui_draw_poly_t points of polygon.
+ *                      Last point is connected to first one
+ * \param[in]       len: Number of points in array. There must be at least 3 points
+ * \param[in]       rule: Fill rule for self intersecting polygons. This parameter can be a value of \ref gui_draw_poly_rule_t enumeration
+ * \param[in]       color: Color to use for drawing
+ * \sa              gui_draw_poly
+ */
+void
+gui_draw_filledpoly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_draw_poly_rule_t rule, gui_color_t color) {
+    gui_draw_poly_edge_t edges_local[POLY_EDGES_LOCAL];
+    gui_draw_poly_edge_t edge, *edges, *e, *n, *active = NULL, **pe;
+    const gui_draw_poly_t *p1, *p2;
+    gui_draw_spans_t spans;
+    gui_dim_t xmin, xmax, ymin, ymax, ystart, yend, y;
+    int32_t xs = 0, xe, w, num;
+    size_t i, j, cnt = 0, next = 0;
+    
+    if (len < 3) {
+        return;
+    }
+    
+    /* Check if polygon is inside drawing region */
+    xmin = xmax = points->x;
+    ymin = ymax = points->y;
+    for (i = 1; i < len; i++) {
+        xmin = GUI_MIN(xmin, points[i].x);
+        xmax = GUI_MAX(xmax, points[i].x);
+        ymin = GUI_MIN(ymin, points[i].y);
+        ymax = GUI_MAX(ymax, points[i].y);
+    }
+    if (xmax <= disp->x1 || xmin >= disp->x2 || ymax <= disp->y1 || ymin >= disp->y2) {
+        return;
+    }
+    ystart = GUI_MAX(ymin, disp->y1);
+    yend = GUI_MIN(ymax, disp->y2);
+    
+    edges = edges_local;
+    if (len > POLY_EDGES_LOCAL) {                   /* Too many edges for stack */
+        edges = GUI_MEMALLOC(sizeof(*edges) * len);
+        if (edges == NULL) {
+            return;
+        }
+    }
+    
+    /* Create edges crossing visible rows, starting on first visible row */
+    for (i = 0; i < len; i++) {
+        p1 = &points[i];
+        p2 = &points[(i + 1) % len];
+        if (p1->y == p2->y) {                       /* Horizontal edges do not cross any row */
+            continue;
+        }
+        edge.dir = 1;
+        if (p1->y > p2->y) {                        /* Edges always go down */
+            edge.dir = -1;
+            p1 = p2;
+            p2 = &points[i];
+        }
+        if (p2->y <= ystart || p1->y >= yend) {     /* Edge is not visible */
+            continue;
+        }
+        edge.y1 = GUI_MAX(p1->y, ystart);
+        edge.y2 = p2->y;
+        edge.dy = p2->y - p1->y;
+        
+        /* Split X position on first row and X increment to integer and fractional part */
+        num = (int32_t)p1->x * edge.dy + (int32_t)(edge.y1 - p1->y) * (p2->x - p1->x);
+        edge.x = num / edge.dy;
+        edge.frac = num % edge.dy;
+        if (edge.frac < 0) {
+            edge.x--;
+            edge.frac += edge.dy;
+        }
+        edge.step = (p2->x - p1->x) / edge.dy;
+        edge.stepfrac = (p2->x - p1->x) % edge.dy;
+        if (edge.stepfrac < 0) {
+            edge.step--;
+            edge.stepfrac += edge.dy;
+        }
+        
+        /* Keep edges sorted by first row */
+        for (j = cnt; j > 0 && edges[j - 1].y1 > edge.y1; j--) {
+            edges[j] = edges[j - 1];
+        }
+        edges[j] = edge;
+        cnt++;
+    }
+    
+    spans_init(&spans, disp, color);
+    for (y = ystart; y < yend && (active != NULL || next < cnt); y++) {
+        /* Remove finished edges */
+        for (pe = &active; *pe != NULL; ) {
+            if ((*pe)->y2 <= y) {
+                *pe = (*pe)->next;
+            } else {
+                pe = &(*pe)->next;
+            }
+        }
+        
+        /* Add edges starting on this row */
+        while (next < cnt && edges[next].y1 <= y) {
+            edges[next].next = active;
+            active = &edges[next];
+            next++;
+        }
+        
+        /* Sort active edges by X position, order changes only when edges cross */
+        e = active;
+        active = NULL;
+        while (e != NULL) {
+            n = e->next;
+            pe = &active;
+            while (*pe != NULL && POLY_EDGE_X(*pe) < POLY_EDGE_X(e)) {
+                pe = &(*pe)->next;
+            }
+            e->next = *pe;
+            *pe = e;
+            e = n;
+        }
+        
+        /* Draw spans between edges where polygon is inside and move edges to next row */
+        w = 0;
+        for (e = active; e != NULL; e = e->next) {
+            if (w == 0) {                           /* Span starts */
+                xs = POLY_EDGE_X(e);
+            }
+            if (rule == GUI_DRAW_POLY_RULE_NONZERO) {
+                w += e->dir;
+            } else {
+                w ^= 1;
+            }
+            if (w == 0) {                           /* Span ends */
+                xs = GUI_MAX(xs, disp->x1);
+                xe = GUI_MIN(POLY_EDGE_X(e), disp->x2);
+                if (xs < xe) {
+                    spans_add(&spans, y, (gui_dim_t)xs, (gui_dim_t)xe);
+                }
+            }
+        }
+        for (e = active; e != NULL; e = e->next) {
+            e->x += e->step;
+            e->frac += e->stepfrac;
+            if (e->frac >= e->dy) {
+                e->frac -= e->dy;
+                e->x++;
+            }
+        }
+    }
+    spans_flush(&spans);
+    
+    if (edges != edges_local) {
+        GUI_MEMFREE(edges);
+    }
+}
+
+/**
+ * \brief           Get font character cache statistics
+ * \param[out]      stats: Pointer to \ref gui_font_cache_stats_t structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_draw_font_getcachestats(gui_font_cache_stats_t* stats) {
+    __GUI_ASSERTPARAMS(stats != NULL);              /* Check input parameters */
+    __GUI_ENTER();                                  /* Enter GUI */
+    
+    *stats = GUI.FontCache;                         /* Copy statistics */
+    
+    __GUI_LEAVE();                                  /* Leave GUI */
+    return 1;
+}
+
+/**
+ * \brief           Get top Y position of text in drawing rectangle
+ * \param[in]       draw: Pointer to \ref gui_draw_font_t structure with specifications about drawing style
+ * \param[in]       height: Total height of text in units of pixels
+ * \return          Top Y position of first line of text
+ */
+static gui_dim_t
+string_get_start_y(const gui_draw_font_t* draw, gui_dim_t height) {
+    gui_dim_t y = draw->y;                          /* Get start Y position */
+    
+    if (draw->align & GUI_VALIGN_CENTER) {          /* Check for vertical align center */
+        y += (draw->height - height) / 2;           /* align center of drawing area */
+    } else if (draw->align & GUI_VALIGN_BOTTOM) {   /* Check for vertical align bottom */
+        y += draw->height - height;                 /* align bottom of drawing area */
+    }
+    
+    if (y < draw->y) {                              /* Check situation first */
+        y = draw->y;
+    }
+    y -= draw->Scrolly;                             /* Go scroll top */
+    
+    /**
+     * Check Y start value in case of edit mode = allow always on bottom
+     */
+    if (draw->flags & GUI_FLAG_FONT_MULTILINE && draw->flags & GUI_FLAG_FONT_EDITMODE) {    /* In multi-line and edit mode */
+        if (height > draw->height) {                /* If text is greater than visible area in edit mode, set it to bottom align */
+            y = draw->y + draw->height - height;
+        }
+    }
+    return y;
+}
+
+/**
+ * \brief           Get start X position of text line in drawing rectangle
+ * \param[in]       draw: Pointer to \ref gui_draw_font_t structure with specifications about drawing style
+ * \param[in]       width: Width of line in units of pixels
+ * \return          Left X position of line
+ */
+static gui_dim_t
+string_get_start_x(const gui_draw_font_t* draw, gui_dim_t width) {
+    gui_dim_t x = draw->x;
+    
+    if (draw->align & GUI_HALIGN_CENTER) {          /* Check for horizontal align center */
+        x += (draw->width - width) / 2;             /* align center of drawing area */
+    } else if (draw->align & GUI_HALIGN_RIGHT) {    /* Check for horizontal align right */
+        x += draw->width - width;                   /* align right of drawing area */
+    }
+    return x;
+}
+
+/**
+ * \brief           Calculate line breaks and line widths of text and save them to layout
+ * \param[in]       font: Pointer to \ref gui_font_t structure with font to use
+ * \param[in]       str: Pointer to string to calculate layout for
+ * \param[in]       draw: Pointer to \ref gui_draw_font_t structure with specifications about drawing style
+ * \param[out]      layout: Pointer to \ref gui_text_layout_t structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+string_create_layout(const gui_font_t* font, const gui_char* str, gui_draw_font_t* draw, gui_text_layout_t* layout) {
+    gui_stringrect_t rect = {0};                    /* Get string object */
+    gui_string_t currStr;
+    gui_text_layout_line_t* line;
+    gui_dim_t x = draw->x;
+    size_t cnt;
+    uint32_t ch;
+    uint8_t i;
+    
+    layout->valid = 0;                              /* Layout is not valid during calculation */
+    layout->count = 0;
+    layout->x_offset = 0;
+    
+    rect.Font = font;                               /* Save font structure */
+    rect.StringDraw = draw;                         /* Set drawing pointer */
+    rect.IsEditMode = !!(draw->flags & GUI_FLAG_FONT_EDITMODE); /* Check if in edit mode */
+    
+    gui_string_prepare(&currStr, str);              /* Prepare string */
+    string_rectangle(&rect, &currStr, 0);           /* Get string width for this box */
+    layout->height = rect.height;                   /* Save total height */
+    if (rect.width > draw->width && draw->flags & GUI_FLAG_FONT_RIGHTALIGN) {   /* Check right align text wider than rectangle */
+        gui_string_prepare(&currStr, str);          /* Prepare string */
+        gui_string_prepare(&currStr, string_get_pointer_for_width(font, &currStr, draw));   /* Get string pointer */
+        layout->x_offset = draw->x - x;             /* Save offset and restore X position */
+        draw->x = x;
+    } else {
+        gui_string_prepare(&currStr, str);          /* Prepare string again */
+    }
+    
+    while ((cnt = string_rectangle(&rect, &currStr, 1)) > 0) {
+        if (layout->count == layout->size) {        /* Allocate more memory for lines */
+            size_t size = layout->size ? 2 * layout->size : 4;
+            line = GUI_MEMREALLOC(layout->lines, size * sizeof(*layout->lines));
+            if (line == NULL) {
+                return 0;
+            }
+            layout->lines = line;
+            layout->size = size;
+        }
+        line = &layout->lines[layout->count++];
+        line->start = currStr.Str - str;            /* Save offset of first character in line */
+        line->count = rect.ReadDraw;                /* Save number of characters to draw */
+        line->width = rect.width;                   /* Save line width */
+        
+        while (cnt-- && gui_string_getch(&currStr, &ch, &i));   /* Go to start of next line */
+        if (!(draw->flags & GUI_FLAG_FONT_MULTILINE)) { /* Only single line available */
+            break;
+        }
+    }
+    
+    layout->text = str;                             /* Save parameters used for layout */
+    layout->font = font;
+    layout->width = draw->width;
+    layout->Lineheight = draw->Lineheight;
+    layout->flags = draw->flags;
+    layout->valid = 1;
+    return 1;
+}
+
+/**
+ * \brief           Write text to screen using cached layout
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       font: Pointer to \ref gui_font_t structure with font to use
+ * \param[in]       draw: Pointer to \ref gui_draw_font_t structure with specifications about drawing style 
+ * \param[in]       layout: Valid layout for text to draw
+ */
+static void
+string_draw_layout(const gui_display_t* disp, const gui_font_t* font, gui_draw_font_t* draw, const gui_text_layout_t* layout) {
+    gui_dim_t x, y;
+    uint32_t ch;
+    uint8_t i;
+    size_t l, cnt;
+    const gui_font_char_t* c;
+    gui_string_t currStr;
+    gui_draw_textline_t tl;
+    uint8_t compose;
+    
+    draw->x += layout->x_offset;                    /* Add X position to align right */
+    y = string_get_start_y(draw, layout->height);   /* Get start Y position */
+    for (l = 0; l < layout->count && y <= disp->y2; l++, y += draw->Lineheight) {
+        if ((y + GUI_MAX(draw->Lineheight, font->size)) < disp->y1) {  /* Line is above visible area */
+            continue;
+        }
+        x = string_get_start_x(draw, layout->lines[l].width);
+        compose = textline_start(&tl, disp, font, draw, x, y);
+        gui_string_prepare(&currStr, layout->text + layout->lines[l].start);
+        for (cnt = layout->lines[l].count; cnt && x <= disp->x2 && gui_string_getch(&currStr, &ch, &i); cnt--) {
+            ch = get_char_from_value(ch);           /* Get char from char value */
+            if ((c = string_get_char_ptr(font, ch)) == 0) { /* Get character pointer */
+                continue;                           /* Character is not known */
+            }
+            if (!compose || !textline_add(&tl, font, x, y, c)) {
+                draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
+            }
+            
+            x += c->x_size + c->x_margin;           /* Increase X position */
+        }
+        if (compose) {
+            textline_finish(&tl);                   /* Draw composed line */
+        }
+    }
+}
+
 /**
  * \brief           Write text to screen
+ * \note            When \ref gui_draw_font_t.layout is set, line breaks are calculated only
+ *                  when text, font or drawing parameters differ from ones in layout
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
  * \param[in]       font: Pointer to \ref gui_font_t structure with font to use
  * \param[in]       str: Pointer to string to draw on screen
@@ -1319,11 +2489,25 @@ gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_
     const gui_font_char_t* c;
     gui_stringrect_t rect = {0};                    /* Get string object */
     gui_string_t currStr;
+    gui_text_layout_t* layout = draw->layout;
+    gui_draw_textline_t tl;
+    uint8_t compose;
     
     if (!draw->Lineheight) {                        /* When line height is not set */
         draw->Lineheight = font->size;              /* Set font size */
     }
     
+    if (layout != NULL) {                           /* Use cached layout if possible */
+        if (!layout->valid || layout->text != str || layout->font != font || layout->width != draw->width
+            || layout->Lineheight != draw->Lineheight || layout->flags != draw->flags) {
+            string_create_layout(font, str, draw, layout);  /* Create new layout */
+        }
+        if (layout->valid) {
+            string_draw_layout(disp, font, draw, layout);
+            return;
+        }
+    }
+    
     rect.Font = font;                               /* Save font structure */
     rect.StringDraw = draw;                         /* Set drawing pointer */
     rect.IsEditMode = !!(draw->flags & GUI_FLAG_FONT_EDITMODE); /* Check if in edit mode */
@@ -1339,37 +2523,12 @@ gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_
         }
     }
     
-    x = draw->x;                                    /* Get start X position */
-    y = draw->y;                                    /* Get start Y position */
-    
-    if (draw->align & GUI_VALIGN_CENTER) {          /* Check for vertical align center */
-        y += (draw->height - rect.height) / 2;      /* align center of drawing area */
-    } else if (draw->align & GUI_VALIGN_BOTTOM) {   /* Check for vertical align bottom */
-        y += draw->height - rect.height;            /* align bottom of drawing area */
-    }
-    
-    if (y < draw->y) {                              /* Check situation first */
-        y = draw->y;
-    }
-    y -= draw->Scrolly;                             /* Go scroll top */
-    
-    /**
-     * Check Y start value in case of edit mode = allow always on bottom
-     */
-    if (draw->flags & GUI_FLAG_FONT_MULTILINE && rect.IsEditMode) { /* In multi-line and edit mode */
-        if (rect.height > draw->height) {           /* If text is greater than visible area in edit mode, set it to bottom align */
-            y = draw->y + draw->height - rect.height;
-        }
-    }    
+    y = string_get_start_y(draw, rect.height);      /* Get start Y position */
     
     gui_string_prepare(&currStr, str);              /* Prepare string again */
     while ((cnt = string_rectangle(&rect, &currStr, 1)) > 0) {
-        x = draw->x;                                       
-        if (draw->align & GUI_HALIGN_CENTER) {      /* Check for horizontal align center */
-            x += (draw->width - rect.width) / 2;    /* align center of drawing area */
-        } else if (draw->align & GUI_HALIGN_RIGHT) {/* Check for horizontal align right */
-            x += draw->width - rect.width;          /* align right of drawing area */
-        }
+        x = string_get_start_x(draw, rect.width);   /* Get start X position */
+        compose = textline_start(&tl, disp, font, draw, x, y);
         while (cnt-- && gui_string_getch(&currStr, &ch, &i)) {  /* Read character by character */
             if (rect.ReadDraw == 0) {               /* Anything to draw? */
                 continue;
@@ -1384,10 +2543,15 @@ gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_
             if ((c = string_get_char_ptr(font, ch)) == 0) { /* Get character pointer */
                 continue;                           /* Character is not known */
             }
-            draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
+            if (!compose || !textline_add(&tl, font, x, y, c)) {
+                draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
+            }
             
             x += c->x_size + c->x_margin;           /* Increase X position */
         }
+        if (compose) {
+            textline_finish(&tl);                   /* Draw composed line */
+        }
         y += draw->Lineheight;                      /* Go to next line */
         if (!(draw->flags & GUI_FLAG_FONT_MULTILINE) || y > disp->y2) { /* Not multiline or over visible Y area */
             break;
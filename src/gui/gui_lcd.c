@@ -64,3 +64,84 @@ gui_lcd_confirmactivelayer(uint8_t layer_num) {
 #endif
     }
 }
+
+/**
+ * \brief           Wait until low-level driver finishes all queued drawing operations
+ * \note            Call it before memory used by queued operations, such as virtual layer,
+ *                  image line buffer or cached character, is released or written by CPU
+ */
+void
+guii_ll_wait(void) {
+    if (GUI.ll.IsReady != NULL) {
+        while (!GUI.ll.IsReady(&GUI.lcd));
+    }
+}
+
+/**
+ * \brief           Add new region to list of invalid regions
+ * 
+ *                  Region is merged with any existing region it overlaps or is closer than
+ *                  \ref GUI_CFG_DISPLAY_REGIONS_MERGE_DIST to. When list is full,
+ *                  all regions are merged to single bounding box.
+ *
+ * \param[in,out]   list: List of regions to add new region to
+ * \param[in]       x1: Region start X position
+ * \param[in]       y1: Region start Y position
+ * \param[in]       x2: Region end X position
+ * \param[in]       y2: Region end Y position
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_lcd_region_add(gui_display_list_t* list, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    gui_display_t* d;
+    size_t i;
+    
+    if (x1 >= x2 || y1 >= y2) {                     /* Ignore empty regions */
+        return 0;
+    }
+    
+    /*
+     * Merge new region with all regions it overlaps or touches.
+     * After merge, region may grow over another region, so start from beginning again
+     */
+    for (i = 0; i < list->count; ) {
+        d = &list->regions[i];
+        if (__GUI_RECT_MATCH(
+                x1 - GUI_CFG_DISPLAY_REGIONS_MERGE_DIST, y1 - GUI_CFG_DISPLAY_REGIONS_MERGE_DIST,
+                x2 + GUI_CFG_DISPLAY_REGIONS_MERGE_DIST, y2 + GUI_CFG_DISPLAY_REGIONS_MERGE_DIST,
+                d->x1, d->y1, d->x2, d->y2)) {
+            if (x1 > d->x1) { x1 = d->x1; }
+            if (y1 > d->y1) { y1 = d->y1; }
+            if (x2 < d->x2) { x2 = d->x2; }
+            if (y2 < d->y2) { y2 = d->y2; }
+            
+            list->count--;                          /* Remove merged region from list... */
+            list->regions[i] = list->regions[list->count];  /* ...by replacing it with last one */
+            i = 0;                                  /* Start over with bigger region */
+        } else {
+            i++;
+        }
+    }
+    
+    /*
+     * If there is no more space in list,
+     * merge all regions to single bounding box
+     */
+    if (list->count >= GUI_CFG_DISPLAY_REGIONS) {
+        for (i = 0; i < list->count; i++) {
+            d = &list->regions[i];
+            if (x1 > d->x1) { x1 = d->x1; }
+            if (y1 > d->y1) { y1 = d->y1; }
+            if (x2 < d->x2) { x2 = d->x2; }
+            if (y2 < d->y2) { y2 = d->y2; }
+        }
+        list->count = 0;
+    }
+    
+    d = &list->regions[list->count++];              /* Get new region entry */
+    d->x1 = x1;
+    d->y1 = y1;
+    d->x2 = x2;
+    d->y2 = y2;
+    return 1;
+}
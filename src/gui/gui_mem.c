@@ -32,6 +32,61 @@
 #include "gui/gui.h"
 #include "gui/gui_mem.h"
 
+#if GUI_CFG_MEM_TLSF
+
+/**
+ * \brief           Memory block of TLSF allocator
+ *
+ *                  Header of each block holds pointer to previous physical block and block size.
+ *                  Free blocks also hold pointers to next and previous block in free list of their size class.
+ */
+typedef struct MemBlock {
+    struct MemBlock* PrevPhysBlock;                 /*!< Pointer to previous physical block, valid only when previous block is free */
+    size_t Size;                                    /*!< Size of block including header, with \ref MEMBLOCK_FREE and \ref MEMBLOCK_PREV_FREE flags */
+    struct MemBlock* NextFreeBlock;                 /*!< Pointer to next free block in list, valid only for free blocks */
+    struct MemBlock* PrevFreeBlock;                 /*!< Pointer to previous free block in list, valid only for free blocks */
+} MemBlock_t;
+
+/**
+ * \brief           Memory alignment bits and absolute number
+ * \note            Lower 2 bits of block size are used for flags, blocks are aligned at least to pointer size
+ */
+#define MEM_ALIGN_NUM               ((size_t)(GUI_CFG_MEM_ALIGNMENT > sizeof(void *) ? GUI_CFG_MEM_ALIGNMENT : sizeof(void *)))
+#define MEM_ALIGN_BITS              (MEM_ALIGN_NUM - 1)
+#define MEM_ALIGN(x)                (((x) + MEM_ALIGN_BITS) & ~MEM_ALIGN_BITS)
+#define MEM_ALIGN_SHIFT             (MEM_ALIGN_NUM == 64 ? 6 : MEM_ALIGN_NUM == 32 ? 5 : MEM_ALIGN_NUM == 16 ? 4 : MEM_ALIGN_NUM == 8 ? 3 : 2)
+
+#define MEMBLOCK_METASIZE           MEM_ALIGN(offsetof(MemBlock_t, NextFreeBlock))  /*!< Header size of used block */
+#define MEMBLOCK_MINSIZE            MEM_ALIGN(sizeof(MemBlock_t))   /*!< Minimal block size, big enough for free list pointers */
+#define MEMBLOCK_FREE               ((size_t)0x01)  /*!< Block is free */
+#define MEMBLOCK_PREV_FREE          ((size_t)0x02)  /*!< Previous physical block is free */
+#define MEMBLOCK_FLAGS              (MEMBLOCK_FREE | MEMBLOCK_PREV_FREE)
+#define MEMBLOCK_SIZE(b)            ((b)->Size & ~MEMBLOCK_FLAGS)
+#define MEMBLOCK_NEXT(b)            ((MemBlock_t *)((uint8_t *)(b) + MEMBLOCK_SIZE(b)))
+
+/**
+ * \brief           Size classes of TLSF allocator
+ *
+ *                  First level is power of 2 of block size, second level divides it linearly to \ref TLSF_SL_COUNT lists.
+ *                  Blocks smaller than \ref TLSF_SMALL_SIZE are all in first level `0`, one list per aligned size.
+ */
+#define TLSF_SL_BITS                4
+#define TLSF_SL_COUNT               (1 << TLSF_SL_BITS)
+#define TLSF_FL_SHIFT               (TLSF_SL_BITS + MEM_ALIGN_SHIFT)
+#define TLSF_SMALL_SIZE             ((size_t)1 << TLSF_FL_SHIFT)
+#define TLSF_FL_COUNT               (sizeof(size_t) * 8 - TLSF_FL_SHIFT + 1)
+
+/**
+ * \brief           Free blocks of single memory region
+ */
+typedef struct {
+    MemBlock_t* FreeLists[TLSF_FL_COUNT][TLSF_SL_COUNT];/*!< Heads of free lists for each size class */
+    size_t FlBitmap;                                /*!< Bit set for each first level with at least one free block */
+    uint32_t SlBitmap[TLSF_FL_COUNT];               /*!< Bit set for each non-empty list in first level */
+} mem_freelist_t;
+
+#else /* GUI_CFG_MEM_TLSF */
+
 typedef struct MemBlock {
     struct MemBlock* NextFreeBlock;                 /*!< Pointer to next free block */
     size_t Size;                                    /*!< Size of block */
@@ -46,23 +101,394 @@ typedef struct MemBlock {
 
 #define MEMBLOCK_METASIZE           MEM_ALIGN(sizeof(MemBlock_t))
 
-static MemBlock_t StartBlock;
-static MemBlock_t* EndBlock = 0;
+/**
+ * \brief           Free blocks of single memory region
+ */
+typedef struct {
+    MemBlock_t StartBlock;                          /*!< Start of list of free blocks */
+    MemBlock_t* EndBlock;                           /*!< Block at the end of region, last in list of free blocks */
+} mem_freelist_t;
+
+#endif /* !GUI_CFG_MEM_TLSF */
+
+/**
+ * \brief           Memory region with its own heap and statistics
+ */
+typedef struct {
+    uint8_t* StartAddr;                             /*!< Start address of heap memory */
+    uint8_t* EndAddr;                               /*!< End address of heap memory, first byte after heap */
+    uint8_t Flags;                                  /*!< Region flags, \ref GUI_MEM_REGION_FAST or \ref GUI_MEM_REGION_NO_DMA */
+    size_t Total;                                   /*!< Size of memory in units of bytes, `0` when region is not used */
+    size_t Available;                               /*!< Number of bytes available to allocate */
+    size_t MinAvailable;                            /*!< Minimal number of bytes ever available */
+    mem_freelist_t Free;                            /*!< Free blocks of region */
+} mem_heap_t;
+
+static mem_heap_t MemHeaps[GUI_CFG_MEM_MAX_REGIONS];/* Memory regions in rising address order */
+static size_t MemHeapsCount;                        /* Number of assigned regions */
 static size_t MemAvailableBytes = 0;
 static size_t MemMinAvailableBytes = 0;
-static size_t MemAllocBit = 0;
 
 static size_t MemTotalSize = 0;                     /* Size of memory in units of bytes */
+
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/**
+ * \brief           Take memory from region statistics
+ * \param[in]       heap: Memory region
+ * \param[in]       size: Number of bytes taken from region
+ */
+static void
+mem_stat_take(mem_heap_t* heap, size_t size) {
+    heap->Available -= size;                        /* Decrease available memory */
+    MemAvailableBytes -= size;
+    if (heap->Available < heap->MinAvailable) {     /* Check if current available memory is less than ever before */
+        heap->MinAvailable = heap->Available;       /* Update minimal available memory */
+    }
+    if (MemAvailableBytes < MemMinAvailableBytes) {
+        MemMinAvailableBytes = MemAvailableBytes;
+    }
+}
+
+/* Return memory back to region statistics */
+static void
+mem_stat_give(mem_heap_t* heap, size_t size) {
+    heap->Available += size;
+    MemAvailableBytes += size;
+}
+
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
+#if GUI_CFG_MEM_TLSF
+
+/**
+ * \brief           Get position of most significant set bit
+ * \param[in]       x: Value to check, must not be `0`
+ * \return          Bit position
+ */
+static uint8_t
+mem_fls(size_t x) {
+#if defined(__GNUC__)
+    return (uint8_t)(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll((unsigned long long)x));
+#else
+    uint8_t r = 0;
+    
+    if (sizeof(size_t) > 4 && (x >> 16 >> 16)) {
+        x = x >> 16 >> 16;
+        r += 32;
+    }
+    if (x & 0xFFFF0000UL) {
+        x >>= 16;
+        r += 16;
+    }
+    if (x & 0xFF00) {
+        x >>= 8;
+        r += 8;
+    }
+    if (x & 0xF0) {
+        x >>= 4;
+        r += 4;
+    }
+    if (x & 0x0C) {
+        x >>= 2;
+        r += 2;
+    }
+    return r + (uint8_t)((x >> 1) & 0x01);
+#endif /* defined(__GNUC__) */
+}
+
+/* Get position of least significant set bit */
+#define mem_ffs(x)                  mem_fls((x) & (~(x) + 1))
+
+/**
+ * \brief           Get first and second level list index for block size
+ * \param[in]       size: Block size
+ * \param[out]      fl: First level index
+ * \param[out]      sl: Second level index
+ */
+static void
+mem_mapping(size_t size, size_t* fl, size_t* sl) {
+    uint8_t f;
+    
+    if (size < TLSF_SMALL_SIZE) {                   /* Small blocks are in linear lists */
+        *fl = 0;
+        *sl = size >> MEM_ALIGN_SHIFT;
+    } else {
+        f = mem_fls(size);
+        *sl = (size >> (f - TLSF_SL_BITS)) ^ TLSF_SL_COUNT; /* Remove leading bit */
+        *fl = f - TLSF_FL_SHIFT + 1;
+    }
+}
+
+/* Insert block to list of free blocks of its size class */
+static void
+mem_insertfreeblock(mem_freelist_t* lists, MemBlock_t* block) {
+    size_t fl, sl;
+    
+    mem_mapping(MEMBLOCK_SIZE(block), &fl, &sl);
+    block->PrevFreeBlock = NULL;
+    block->NextFreeBlock = lists->FreeLists[fl][sl];
+    if (block->NextFreeBlock != NULL) {
+        block->NextFreeBlock->PrevFreeBlock = block;
+    }
+    lists->FreeLists[fl][sl] = block;
+    lists->FlBitmap |= (size_t)1 << fl;
+    lists->SlBitmap[fl] |= (uint32_t)1 << sl;
+}
+
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/* Remove block from list of free blocks */
+static void
+mem_removefreeblock(mem_freelist_t* lists, MemBlock_t* block) {
+    size_t fl, sl;
+    
+    mem_mapping(MEMBLOCK_SIZE(block), &fl, &sl);
+    if (block->NextFreeBlock != NULL) {
+        block->NextFreeBlock->PrevFreeBlock = block->PrevFreeBlock;
+    }
+    if (block->PrevFreeBlock != NULL) {
+        block->PrevFreeBlock->NextFreeBlock = block->NextFreeBlock;
+    } else {                                        /* Block is head of list */
+        lists->FreeLists[fl][sl] = block->NextFreeBlock;
+        if (lists->FreeLists[fl][sl] == NULL) {     /* List is now empty */
+            lists->SlBitmap[fl] &= ~((uint32_t)1 << sl);
+            if (!lists->SlBitmap[fl]) {
+                lists->FlBitmap &= ~((size_t)1 << fl);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Find free block of at least required size
+ * \param[in]       lists: Free blocks of region
+ * \param[in]       size: Required block size
+ * \return          Free block on success, `NULL` otherwise
+ */
+static MemBlock_t*
+mem_findfreeblock(mem_freelist_t* lists, size_t size) {
+    size_t fl, sl, map;
+    
+    if (size >= TLSF_SMALL_SIZE) {                  /* Round up to next list, all blocks there are big enough */
+        size += ((size_t)1 << (mem_fls(size) - TLSF_SL_BITS)) - 1;
+    }
+    mem_mapping(size, &fl, &sl);
+    if (fl >= TLSF_FL_COUNT) {
+        return NULL;
+    }
+    map = lists->SlBitmap[fl] & (~(uint32_t)0 << sl);/* Lists of the same first level with bigger blocks */
+    if (!map) {
+        map = fl + 1 < TLSF_FL_COUNT ? lists->FlBitmap & (~(size_t)0 << (fl + 1)) : 0;
+        if (!map) {                                 /* No bigger blocks available */
+            return NULL;
+        }
+        fl = mem_ffs(map);
+        map = lists->SlBitmap[fl];
+    }
+    sl = mem_ffs(map);
+    return lists->FreeLists[fl][sl];
+}
+
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
+/**
+ * \brief           Create heap in memory region
+ * \param[in]       heap: Memory region with aligned start address and size set
+ * \return          `1` on success, `0` when region is too small
+ */
+static uint8_t
+mem_heap_init(mem_heap_t* heap) {
+    MemBlock_t *FirstBlock, *LastBlock;
+    size_t MemSize = heap->EndAddr - heap->StartAddr;
+    
+    if (MemSize < (MEMBLOCK_MINSIZE + MEMBLOCK_METASIZE)) { /* Check minimum region size */
+        return 0;
+    }
+    
+    /**
+     * Region is one free block followed by used block of size 0,
+     * which stops merging of free blocks at the end of region
+     */
+    FirstBlock = (MemBlock_t *)heap->StartAddr;
+    FirstBlock->PrevPhysBlock = NULL;
+    FirstBlock->Size = (MemSize - MEMBLOCK_METASIZE) | MEMBLOCK_FREE;
+    LastBlock = MEMBLOCK_NEXT(FirstBlock);
+    LastBlock->PrevPhysBlock = FirstBlock;
+    LastBlock->Size = MEMBLOCK_PREV_FREE;
+    mem_insertfreeblock(&heap->Free, FirstBlock);
+    
+    heap->Total = MEMBLOCK_SIZE(FirstBlock);
+    return 1;
+}
+
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/**
+ * \brief           Allocate block from region
+ * \param[in]       heap: Memory region
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Pointer to allocated memory on success, `NULL` otherwise
+ */
+static void*
+mem_block_alloc(mem_heap_t* heap, size_t size) {
+    MemBlock_t *Curr, *Next;
+    size_t BlockSize;
+    
+    if (!size || size > heap->Available) {          /* Check input parameters */
+        return 0;
+    }
+    
+    size = MEM_ALIGN(size) + MEMBLOCK_METASIZE;
+    if (size < MEMBLOCK_MINSIZE) {
+        size = MEMBLOCK_MINSIZE;
+    }
+    if (size > heap->Available || (Curr = mem_findfreeblock(&heap->Free, size)) == NULL) {
+        return 0;
+    }
+    mem_removefreeblock(&heap->Free, Curr);
+    
+    /**
+     * Split block when remaining memory is enough for new free block
+     */
+    BlockSize = MEMBLOCK_SIZE(Curr);
+    if ((BlockSize - size) >= MEMBLOCK_MINSIZE) {
+        Next = (MemBlock_t *)((uint8_t *)Curr + size);
+        Next->Size = (BlockSize - size) | MEMBLOCK_FREE;    /* Block before it is allocated */
+        Next->PrevPhysBlock = Curr;
+        MEMBLOCK_NEXT(Next)->PrevPhysBlock = Next;  /* Block after it already has previous free flag set */
+        mem_insertfreeblock(&heap->Free, Next);
+        BlockSize = size;
+    } else {
+        MEMBLOCK_NEXT(Curr)->Size &= ~MEMBLOCK_PREV_FREE;
+    }
+    Curr->Size = BlockSize | (Curr->Size & MEMBLOCK_PREV_FREE); /* Block is allocated now */
+    
+    mem_stat_take(heap, BlockSize);                 /* Decrease available memory */
+    return (void *)((uint8_t *)Curr + MEMBLOCK_METASIZE);
+}
+
+/* Free block back to its region */
+static void
+mem_block_free(mem_heap_t* heap, void* ptr) {
+    MemBlock_t *block, *next;
+
+    block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);   /* Get block data pointer from input pointer */
+    if ((block->Size & MEMBLOCK_FREE) || !MEMBLOCK_SIZE(block)) {   /* Block must be allocated */
+        return;
+    }
+    mem_stat_give(heap, MEMBLOCK_SIZE(block));      /* Increase available bytes back */
+    
+    /**
+     * Merge with free neighbours, at most one on each side
+     */
+    if (block->Size & MEMBLOCK_PREV_FREE) {
+        MemBlock_t* prev = block->PrevPhysBlock;
+        mem_removefreeblock(&heap->Free, prev);
+        prev->Size += MEMBLOCK_SIZE(block);
+        block = prev;
+    }
+    next = MEMBLOCK_NEXT(block);
+    if (next->Size & MEMBLOCK_FREE) {
+        mem_removefreeblock(&heap->Free, next);
+        block->Size += MEMBLOCK_SIZE(next);
+        next = MEMBLOCK_NEXT(block);
+    }
+    block->Size |= MEMBLOCK_FREE;
+    next->PrevPhysBlock = block;
+    next->Size |= MEMBLOCK_PREV_FREE;
+    mem_insertfreeblock(&heap->Free, block);
+}
+
+/* Get size of user memory from input pointer */
+static size_t
+mem_getusersize(void* ptr) {
+    MemBlock_t* block;
+    
+    if (!ptr) {
+        return 0;
+    }
+    block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);   /* Get block meta data pointer */
+    if (!(block->Size & MEMBLOCK_FREE)) {           /* Memory is actually allocated */
+        return MEMBLOCK_SIZE(block) - MEMBLOCK_METASIZE;    /* Return size of block */
+    }
+    return 0;
+}
+
+/**
+ * \brief           Resize allocated block without moving it
+ *
+ *                  Block grows to next physical block when it is free and big enough.
+ *                  Unused tail of block is returned to free lists.
+ *
+ * \param[in]       heap: Memory region of block
+ * \param[in]       ptr: Pointer to allocated memory
+ * \param[in]       size: New size in units of bytes
+ * \return          `1` when block was resized in place, `0` otherwise
+ */
+static uint8_t
+mem_block_resize(mem_heap_t* heap, void* ptr, size_t size) {
+    MemBlock_t *block, *next, *tail;
+    size_t BlockSize;
+    
+    block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);   /* Get block meta data pointer */
+    if ((block->Size & MEMBLOCK_FREE) || !MEMBLOCK_SIZE(block) || !size || size > heap->Total) {
+        return 0;
+    }
+    size = MEM_ALIGN(size) + MEMBLOCK_METASIZE;
+    if (size < MEMBLOCK_MINSIZE) {
+        size = MEMBLOCK_MINSIZE;
+    }
+    BlockSize = MEMBLOCK_SIZE(block);
+    next = MEMBLOCK_NEXT(block);
+    if (size > BlockSize) {                         /* Grow to next free block */
+        if (!(next->Size & MEMBLOCK_FREE) || (BlockSize + MEMBLOCK_SIZE(next)) < size) {
+            return 0;
+        }
+        mem_removefreeblock(&heap->Free, next);
+        mem_stat_take(heap, MEMBLOCK_SIZE(next));
+        block->Size += MEMBLOCK_SIZE(next);
+        BlockSize = MEMBLOCK_SIZE(block);
+        next = MEMBLOCK_NEXT(block);
+        next->Size &= ~MEMBLOCK_PREV_FREE;
+    }
+    if ((BlockSize - size) >= MEMBLOCK_MINSIZE) {   /* Return unused tail to free lists */
+        tail = (MemBlock_t *)((uint8_t *)block + size);
+        tail->Size = BlockSize - size;
+        tail->PrevPhysBlock = block;
+        block->Size -= tail->Size;
+        mem_stat_give(heap, tail->Size);
+        if (next->Size & MEMBLOCK_FREE) {           /* Merge with free block after it */
+            mem_removefreeblock(&heap->Free, next);
+            tail->Size += MEMBLOCK_SIZE(next);
+            next = MEMBLOCK_NEXT(tail);
+        }
+        tail->Size |= MEMBLOCK_FREE;
+        next->PrevPhysBlock = tail;
+        next->Size |= MEMBLOCK_PREV_FREE;
+        mem_insertfreeblock(&heap->Free, tail);
+    }
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
+#else /* GUI_CFG_MEM_TLSF */
+
+static size_t MemAllocBit = 0;
+
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
 /* Insert block to list of free blocks */
 static void
-mem_insertfreeblock(MemBlock_t* newBlock) {
+mem_insertfreeblock(mem_freelist_t* lists, MemBlock_t* newBlock) {
     MemBlock_t* ptr;
     uint8_t* addr;
 
     /**
      * Find block position to insert new block between
      */
-    for (ptr = &StartBlock; ptr && ptr->NextFreeBlock < newBlock; ptr = ptr->NextFreeBlock);
+    for (ptr = &lists->StartBlock; ptr && ptr->NextFreeBlock < newBlock; ptr = ptr->NextFreeBlock);
 
     /**
      * If the new inserted block and block before create a one big block (contiguous)
@@ -79,8 +505,8 @@ mem_insertfreeblock(MemBlock_t* newBlock) {
      */
     addr = (uint8_t *)newBlock;
     if ((uint8_t *)(addr + newBlock->Size) == (uint8_t *)ptr->NextFreeBlock) {
-        if (ptr->NextFreeBlock == EndBlock) {       /* Does it points to the end? */
-            newBlock->NextFreeBlock = EndBlock;     /* Set end block pointer */
+        if (ptr->NextFreeBlock == lists->EndBlock) {    /* Does it points to the end? */
+            newBlock->NextFreeBlock = lists->EndBlock;   /* Set end block pointer */
         } else {
             newBlock->Size += ptr->NextFreeBlock->Size; /* Expand of current block for size of next free block which is right behind new block */
             newBlock->NextFreeBlock = ptr->NextFreeBlock->NextFreeBlock; /* Next free is pointed to the next one of previous next */
@@ -100,122 +526,66 @@ mem_insertfreeblock(MemBlock_t* newBlock) {
     }
 }
 
-uint8_t
-mem_assignmem(const mem_region_t* regions, size_t len) {
-    uint8_t* MemStartAddr;
-    size_t MemSize;
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
+/**
+ * \brief           Create heap in memory region
+ * \param[in]       heap: Memory region with aligned start address and size set
+ * \return          `1` on success, `0` when region is too small
+ */
+static uint8_t
+mem_heap_init(mem_heap_t* heap) {
     MemBlock_t* FirstBlock;
-    MemBlock_t* PreviousEndBlock = 0;
-    size_t i;
+    size_t MemSize = heap->EndAddr - heap->StartAddr;
     
-    if (EndBlock) {                                 /* Regions already defined */
+    if (MemSize < (MEM_ALIGN_NUM + MEMBLOCK_METASIZE)) {    /* Check minimum region size */
         return 0;
     }
     
     /**
-     * Check if region address are linear and rising
+     * StartBlock is fixed variable for start list of free blocks
      */
-    MemStartAddr = (uint8_t *)0;
-    for (i = 0; i < len; i++) {
-        if (MemStartAddr >= (uint8_t *)regions[i].StartAddress) {   /* Check if previous greater than current */
-            return 0;                               /* Return as invalid and failed */
-        }
-        MemStartAddr = (uint8_t *)regions[i].StartAddress;  /* Save as previous address */
-    }
-
-    while (len--) {
-        /**
-         * Check minimum region size
-         */
-        MemSize = regions->Size;
-        if (MemSize < (MEM_ALIGN_NUM + MEMBLOCK_METASIZE)) {
-            regions++;
-            continue;
-        }
-        /**
-         * Get start address and check memory alignment
-         * if necessary, decrease memory region size
-         */
-        MemStartAddr = (uint8_t *)regions->StartAddress;    /* Actual heap memory address */
-        if ((size_t)MemStartAddr & MEM_ALIGN_BITS) {    /* Check alignment boundary */
-            MemStartAddr += MEM_ALIGN_NUM - ((size_t)MemStartAddr & MEM_ALIGN_BITS);
-            MemSize -= MemStartAddr - (uint8_t *)regions->StartAddress;
-        }
-        
-        /**
-         * Check memory size alignment if match
-         */
-        if (MemSize & MEM_ALIGN_BITS) {
-            MemSize &= ~MEM_ALIGN_BITS;             /* Clear lower bits of memory size only */
-        }
-
-        /**
-         * StartBlock is fixed variable for start list of free blocks
-         *
-         * Set free blocks linked list on initialized
-         *
-         * Set Start block only if end block is not yet defined = first run
-         */
-        if (!EndBlock) {
-            StartBlock.NextFreeBlock = (MemBlock_t *)MemStartAddr;
-            StartBlock.Size = 0;
-        }
-        
-        PreviousEndBlock = EndBlock;                /* Save previous end block to set next block later */
-        
-        /**
-         * Set pointer to end of free memory - block region memory
-         * Calculate new end block in region
-         */
-        EndBlock = (MemBlock_t *)((uint8_t *)MemStartAddr + MemSize - MEMBLOCK_METASIZE);
-        EndBlock->NextFreeBlock = 0;                /* No more free blocks after end is reached */
-        EndBlock->Size = 0;                         /* Empty block */
-
-        /**
-         * Initialize start of region memory
-         * Create first block in region
-         */
-        FirstBlock = (MemBlock_t *)MemStartAddr;
-        FirstBlock->Size = MemSize - MEMBLOCK_METASIZE; /* Exclude end block in chain */
-        FirstBlock->NextFreeBlock = EndBlock;       /* Last block is next free in chain */
+    heap->Free.StartBlock.NextFreeBlock = (MemBlock_t *)heap->StartAddr;
+    heap->Free.StartBlock.Size = 0;
+    
+    /**
+     * Set pointer to end of free memory - block region memory
+     * Calculate new end block in region
+     */
+    heap->Free.EndBlock = (MemBlock_t *)(heap->EndAddr - MEMBLOCK_METASIZE);
+    heap->Free.EndBlock->NextFreeBlock = 0;         /* No more free blocks after end is reached */
+    heap->Free.EndBlock->Size = 0;                  /* Empty block */
 
-        /**
-         * If we have previous end block
-         * End block of previous region
-         *
-         * Set previous end block to start of next region
-         */
-        if (PreviousEndBlock) {
-            PreviousEndBlock->NextFreeBlock = FirstBlock;
-        }
-        
-        /**
-         * Set number of free bytes available to allocate in region
-         */
-        MemAvailableBytes += FirstBlock->Size;
-        
-        regions++;                                  /* Go to next region */
-    }
+    /**
+     * Initialize start of region memory
+     * Create first block in region
+     */
+    FirstBlock = (MemBlock_t *)heap->StartAddr;
+    FirstBlock->Size = MemSize - MEMBLOCK_METASIZE; /* Exclude end block in chain */
+    FirstBlock->NextFreeBlock = heap->Free.EndBlock;/* Last block is next free in chain */
     
-    MemMinAvailableBytes = MemAvailableBytes;       /* Save minimum ever available bytes in region */
+    heap->Total = FirstBlock->Size;                 /* Set number of free bytes available to allocate in region */
     
     /**
      * Set upper bit in memory allocation bit
      */
     MemAllocBit = (size_t)((size_t)1 << ((sizeof(size_t) * 8 - 1)));
-    
-    return 1;                                       /* Regions set as expected */
+    return 1;
 }
 
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/**
+ * \brief           Allocate block from region
+ * \param[in]       heap: Memory region
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Pointer to allocated memory on success, `NULL` otherwise
+ */
 static void*
-mem_alloc(size_t size) {
+mem_block_alloc(mem_heap_t* heap, size_t size) {
     MemBlock_t *Prev, *Curr, *Next;
     void* retval = 0;
 
-    if (!EndBlock) {                                /* If end block is not yet defined */
-        return 0;                                   /* Invalid, not initialized */
-    }
-    
     /**
      * TODO: Check alignment maybe?
      */    
@@ -224,7 +594,7 @@ mem_alloc(size_t size) {
     }
 
     size = MEM_ALIGN(size) + MEMBLOCK_METASIZE;
-    if (size > MemAvailableBytes) {                 /* Check if we have enough memory available */
+    if (size > heap->Available) {                   /* Check if we have enough memory available */
         return 0;
     }
 
@@ -233,7 +603,7 @@ mem_alloc(size_t size) {
      * Go through free blocks until enough memory is found
      * or end block is reached (no next free block)
      */
-    Prev = &StartBlock;                             /* Set first first block as previous */
+    Prev = &heap->Free.StartBlock;                  /* Set first first block as previous */
     Curr = Prev->NextFreeBlock;                     /* Set next block as current */
     while ((Curr->Size < size) && (Curr->NextFreeBlock)) {
         Prev = Curr;
@@ -247,7 +617,7 @@ mem_alloc(size_t size) {
      * Feature may be very risky later because of fragmentation
      */
     
-    if (Curr != EndBlock) {                         /* We found empty block of enough memory available */
+    if (Curr != heap->Free.EndBlock) {              /* We found empty block of enough memory available */
         retval = (void *)((uint8_t *)Prev->NextFreeBlock + MEMBLOCK_METASIZE);    /* Set return value */
         Prev->NextFreeBlock = Curr->NextFreeBlock;  /* Since block is now allocated, remove it from free chain */
 
@@ -265,15 +635,11 @@ mem_alloc(size_t size) {
              * Add virtual block to list of free blocks.
              * It is placed directly after currently allocated memory
              */
-            mem_insertfreeblock(Next);              /* Insert free memory block to list of free memory blocks (linked list chain) */
+            mem_insertfreeblock(&heap->Free, Next); /* Insert free memory block to list of free memory blocks (linked list chain) */
         }
+        mem_stat_take(heap, Curr->Size);            /* Decrease available memory, block may be bigger than required */
         Curr->Size |= MemAllocBit;                  /* Set allocated bit = memory is allocated */
         Curr->NextFreeBlock = 0;                    /* Clear next free block pointer as there is no one */
-
-        MemAvailableBytes -= size;                  /* Decrease available memory */
-        if (MemAvailableBytes < MemMinAvailableBytes) { /* Check if current available memory is less than ever before */
-            MemMinAvailableBytes = MemAvailableBytes;   /* Update minimal available memory */
-        }
     } else {
         /* Allocation failed, no free blocks of required size */
     }
@@ -281,14 +647,11 @@ mem_alloc(size_t size) {
     return retval;
 }
 
+/* Free block back to its region */
 static void
-mem_free(void* ptr) {
+mem_block_free(mem_heap_t* heap, void* ptr) {
     MemBlock_t* block;
 
-    if (!ptr) {                                     /* To be in compliance with C free function */
-        return;
-    }
-
     block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);   /* Get block data pointer from input pointer */
 
     /**
@@ -301,8 +664,8 @@ mem_free(void* ptr) {
          * List will automatically take care for fragmentation and mix segments back
          */
         block->Size &= ~MemAllocBit;                /* Clear allocated bit */
-        MemAvailableBytes += block->Size;           /* Increase available bytes back */
-        mem_insertfreeblock(block);                 /* Insert block to list of free blocks */
+        mem_stat_give(heap, block->Size);           /* Increase available bytes back */
+        mem_insertfreeblock(&heap->Free, block);    /* Insert block to list of free blocks */
     }
 }
 
@@ -321,38 +684,256 @@ mem_getusersize(void* ptr) {
     return 0;
 }
 
+/**
+ * \brief           Resize allocated block without moving it
+ *
+ *                  Block grows to next physical block when it is free and big enough.
+ *                  Unused tail of block is returned to list of free blocks.
+ *
+ * \param[in]       heap: Memory region of block
+ * \param[in]       ptr: Pointer to allocated memory
+ * \param[in]       size: New size in units of bytes
+ * \return          `1` when block was resized in place, `0` otherwise
+ */
+static uint8_t
+mem_block_resize(mem_heap_t* heap, void* ptr, size_t size) {
+    MemBlock_t *block, *prev, *next, *tail;
+    size_t BlockSize;
+    
+    block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);   /* Get block meta data pointer */
+    if (!(block->Size & MemAllocBit) || block->NextFreeBlock || !size || size >= MemAllocBit) {
+        return 0;
+    }
+    size = MEM_ALIGN(size) + MEMBLOCK_METASIZE;
+    BlockSize = block->Size & ~MemAllocBit;
+    if (size > BlockSize) {                         /* Grow to next free block */
+        for (prev = &heap->Free.StartBlock; prev->NextFreeBlock < block; prev = prev->NextFreeBlock);
+        next = prev->NextFreeBlock;                 /* First free block after current block */
+        if ((uint8_t *)next != ((uint8_t *)block + BlockSize) || !next->Size || (BlockSize + next->Size) < size) {
+            return 0;
+        }
+        prev->NextFreeBlock = next->NextFreeBlock;  /* Remove block from free chain */
+        mem_stat_take(heap, next->Size);
+        BlockSize += next->Size;
+    }
+    if ((BlockSize - size) > (2 * MEMBLOCK_METASIZE)) { /* Return unused tail to free chain */
+        tail = (MemBlock_t *)((uint8_t *)block + size);
+        tail->Size = BlockSize - size;
+        BlockSize = size;
+        mem_stat_give(heap, tail->Size);
+        mem_insertfreeblock(&heap->Free, tail);
+    }
+    block->Size = BlockSize | MemAllocBit;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
+#endif /* !GUI_CFG_MEM_TLSF */
+
+/**
+ * \brief           Assign memory regions and create heap in each of them
+ * \param[in]       regions: List of regions in rising address order
+ * \param[in]       len: Number of regions, up to \ref GUI_CFG_MEM_MAX_REGIONS
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+mem_assignmem(const mem_region_t* regions, size_t len) {
+    uint8_t* MemStartAddr;
+    mem_heap_t* heap;
+    uint8_t ret = 0;
+    size_t i;
+    
+    if (MemHeapsCount || len > GUI_COUNT_OF(MemHeaps)) {    /* Regions already defined or too many of them */
+        return 0;
+    }
+    
+    /**
+     * Check if region address are linear and rising
+     */
+    MemStartAddr = (uint8_t *)0;
+    for (i = 0; i < len; i++) {
+        if (MemStartAddr >= (uint8_t *)regions[i].StartAddress) {   /* Check if previous greater than current */
+            return 0;                               /* Return as invalid and failed */
+        }
+        MemStartAddr = (uint8_t *)regions[i].StartAddress;  /* Save as previous address */
+    }
+
+    /**
+     * Each region keeps its index, regions too small
+     * for heap stay in list with total size set to `0`
+     */
+    for (i = 0; i < len; i++, regions++) {
+        heap = &MemHeaps[i];
+        heap->Flags = regions->Flags;
+        
+        /**
+         * Align start address and size of region
+         */
+        MemStartAddr = (uint8_t *)MEM_ALIGN((size_t)regions->StartAddress);
+        if ((size_t)(MemStartAddr - (uint8_t *)regions->StartAddress) >= regions->Size) {
+            continue;
+        }
+        heap->StartAddr = MemStartAddr;
+        heap->EndAddr = MemStartAddr + ((regions->Size - (MemStartAddr - (uint8_t *)regions->StartAddress)) & ~MEM_ALIGN_BITS);
+        if (!mem_heap_init(heap)) {
+            continue;
+        }
+        heap->Available = heap->Total;
+        heap->MinAvailable = heap->Total;
+        MemAvailableBytes += heap->Total;
+        ret = 1;
+    }
+    MemHeapsCount = len;
+    
+    MemTotalSize = MemAvailableBytes;
+    MemMinAvailableBytes = MemAvailableBytes;       /* Save minimum ever available bytes in region */
+    return ret;
+}
+
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/**
+ * \brief           Find region which owns memory
+ * \param[in]       ptr: Pointer to allocated memory
+ * \return          Region of memory or `NULL` when memory is not in any region
+ */
+static mem_heap_t*
+mem_heap_find(const void* ptr) {
+    size_t i;
+    
+    for (i = 0; i < MemHeapsCount; i++) {
+        if (MemHeaps[i].Total && (const uint8_t *)ptr >= MemHeaps[i].StartAddr
+            && (const uint8_t *)ptr < MemHeaps[i].EndAddr) {
+            return &MemHeaps[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Check if region is used for allocation class in specific pass
+ *
+ *                  Metadata is placed to fast regions first, pixel buffers and bulk data to other regions first.
+ *                  Pixel buffers are never placed to regions not reachable by DMA.
+ *
+ * \param[in]       heap: Memory region
+ * \param[in]       cls: Allocation class
+ * \param[in]       pass: `0` for preferred regions, `1` for fallback regions
+ * \return          `1` when region is used, `0` otherwise
+ */
+static uint8_t
+mem_heap_match(const mem_heap_t* heap, gui_mem_class_t cls, uint8_t pass) {
+    uint8_t fast = (heap->Flags & GUI_MEM_REGION_FAST) ? 1 : 0;
+    
+    if (!heap->Total) {
+        return 0;
+    }
+    switch (cls) {
+        case GUI_MEM_CLASS_PIXEL:
+            if (heap->Flags & GUI_MEM_REGION_NO_DMA) {
+                return 0;
+            }
+            return pass == fast;
+        case GUI_MEM_CLASS_BULK:
+            return pass == fast;
+        default:
+            return pass != fast;
+    }
+}
+
+/* Allocate memory from regions in order of allocation class */
+static void*
+mem_alloc(size_t size, gui_mem_class_t cls) {
+    void* ptr;
+    uint8_t pass;
+    size_t i;
+    
+    for (pass = 0; pass < 2; pass++) {
+        for (i = 0; i < MemHeapsCount; i++) {
+            if (mem_heap_match(&MemHeaps[i], cls, pass)
+                && (ptr = mem_block_alloc(&MemHeaps[i], size)) != NULL) {
+                return ptr;
+            }
+        }
+    }
+    return NULL;
+}
+
+/* Free memory to region it belongs to */
+static void
+mem_free(void* ptr) {
+    mem_heap_t* heap;
+    
+    if (ptr != NULL && (heap = mem_heap_find(ptr)) != NULL) {   /* To be in compliance with C free function */
+        mem_block_free(heap, ptr);
+    }
+}
+
 /* Allocate memory and set it to 0 */
 static void*
-mem_calloc(size_t num, size_t size) {
+mem_calloc(size_t num, size_t size, gui_mem_class_t cls) {
     void* ptr;
     size_t tot_len = num * size;
     
-    if ((ptr = mem_alloc(tot_len)) != NULL) {       /* Try to allocate memory */
+    if ((ptr = mem_alloc(tot_len, cls)) != NULL) {  /* Try to allocate memory */
         memset(ptr, 0x00, tot_len);                 /* Reset entire memory */
     }
     return ptr;
 }
 
-/* Reallocate previously allocated memory */
+static gui_mem_realloc_stats_t MemReallocStats;    /* Counters of reallocation paths */
+
+/**
+ * \brief           Reallocate previously allocated memory
+ *
+ *                  When block cannot be resized in place, new block is allocated in the same region first
+ *                  and then in other regions. Memory reachable by DMA is never moved to region not reachable by DMA.
+ *
+ * \param[in]       ptr: Pointer to allocated memory or `NULL`
+ * \param[in]       size: New size in units of bytes
+ * \return          Pointer to memory on success, `NULL` otherwise
+ */
 static void*
 mem_realloc(void* ptr, size_t size) {
+    mem_heap_t* heap;
     void* newPtr;
-    size_t oldSize;
+    size_t oldSize, i;
     
     if (!ptr) {                                     /* If pointer is not valid */
-        return mem_alloc(size);                     /* Only allocate memory */
+        return mem_alloc(size, GUI_MEM_CLASS_META); /* Only allocate memory */
+    }
+    if ((heap = mem_heap_find(ptr)) == NULL) {
+        return 0;
     }
     
     oldSize = mem_getusersize(ptr);                 /* Get size of old pointer */
-    newPtr = mem_alloc(size);                       /* Try to allocate new memory block */
+    if (mem_block_resize(heap, ptr, size)) {        /* Try to resize block without copy first */
+        if (size > oldSize) {
+            MemReallocStats.grow_in_place++;
+        } else {
+            MemReallocStats.shrink_in_place++;
+        }
+        return ptr;
+    }
+    newPtr = mem_block_alloc(heap, size);           /* Try to allocate new memory block in the same region */
+    for (i = 0; newPtr == NULL && i < MemHeapsCount; i++) {
+        if (&MemHeaps[i] != heap && MemHeaps[i].Total
+            && !(MemHeaps[i].Flags & ~heap->Flags & GUI_MEM_REGION_NO_DMA)) {
+            newPtr = mem_block_alloc(&MemHeaps[i], size);
+        }
+    }
     if (newPtr != NULL) {                           /* Check success */
         memcpy(newPtr, ptr, size > oldSize ? oldSize : size);   /* Copy old data to new array */
-        mem_free(ptr);                              /* Free old pointer */
+        mem_block_free(heap, ptr);                  /* Free old pointer */
+        MemReallocStats.moved++;
         return newPtr;                              /* Return new pointer */
     }
     return 0;
 }
 
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
 static size_t
 mem_getfree(void) {
     return MemAvailableBytes;                       /* Return free bytes available for allocation */
@@ -368,6 +949,150 @@ mem_getminfree(void) {
     return MemMinAvailableBytes;                    /* Return minimal bytes ever available */
 }
 
+/* Allocate memory from heap */
+static void*
+mem_heap_alloc(size_t size, gui_mem_class_t cls) {
+#if GUI_CFG_USE_MEM
+    return mem_alloc(size, cls);
+#else
+    GUI_UNUSED(cls);
+    return malloc(size);
+#endif /* GUI_CFG_USE_MEM */
+}
+
+/* Free memory to heap */
+static void
+mem_heap_free(void* ptr) {
+#if GUI_CFG_USE_MEM
+    mem_free(ptr);
+#else
+    free(ptr);
+#endif /* GUI_CFG_USE_MEM */
+}
+
+#if GUI_CFG_USE_MEM_POOLS || __DOXYGEN__
+
+/**
+ * \brief           Pool of fixed size blocks
+ */
+typedef struct {
+    size_t BlockSize;                               /*!< Maximal allocation size served by pool */
+    size_t Blocks;                                  /*!< Number of blocks in pool */
+    uint8_t* Memory;                                /*!< Memory of all blocks, reserved by \ref mem_pool_reserve or `NULL` */
+    void* FreeBlock;                                /*!< First free block, each free block points to next one */
+    size_t Used;                                    /*!< Number of used blocks */
+    size_t MaxUsed;                                 /*!< Maximal number of used blocks at a time */
+    size_t Fallbacks;                               /*!< Number of allocations done on heap because pool was full */
+} mem_pool_t;
+
+/**
+ * \brief           Distance between blocks in pool, big enough for pointer to next free block
+ */
+#define MEM_POOL_STRIDE(pool)       GUI_MEM_ALIGN(GUI_MAX((pool)->BlockSize, sizeof(void *)))
+
+static mem_pool_t MemPools[] = { GUI_CFG_MEM_POOLS };   /* List of pools sorted by block size */
+
+/**
+ * \brief           Reserve memory of all pools which do not have it yet
+ *
+ *                  Called right after memory regions are assigned, so pools are placed
+ *                  at the start of first region used for \ref GUI_MEM_CLASS_META allocations
+ *                  and do not split heap later.
+ *
+ * \return          `1` when all pools have memory, `0` otherwise
+ */
+static uint8_t
+mem_pool_reserve(void) {
+    mem_pool_t* pool;
+    uint8_t* block;
+    size_t i;
+    
+    for (pool = MemPools; pool < &MemPools[GUI_COUNT_OF(MemPools)]; pool++) {
+        if (pool->Memory != NULL || !pool->Blocks) {
+            continue;
+        }
+        pool->Memory = mem_heap_alloc(pool->Blocks * MEM_POOL_STRIDE(pool), GUI_MEM_CLASS_META);
+        if (pool->Memory == NULL) {
+            GUI_DEBUG("Not enough memory for pool of %u bytes blocks\r\n", (unsigned)pool->BlockSize);
+            return 0;
+        }
+        for (i = pool->Blocks, block = NULL; i > 0; i--) {  /* Link all blocks to list, first block on top */
+            *(void **)&pool->Memory[(i - 1) * MEM_POOL_STRIDE(pool)] = block;
+            block = &pool->Memory[(i - 1) * MEM_POOL_STRIDE(pool)];
+        }
+        pool->FreeBlock = block;
+    }
+    return 1;
+}
+
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/* Forget memory of all pools */
+static void
+mem_pool_unreserve(void) {
+    mem_pool_t* pool;
+    
+    for (pool = MemPools; pool < &MemPools[GUI_COUNT_OF(MemPools)]; pool++) {
+        pool->Memory = NULL;
+        pool->FreeBlock = NULL;
+    }
+}
+
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
+/**
+ * \brief           Allocate block from first pool with big enough blocks
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Pointer to block on success, `NULL` when size does not fit to any pool or pool is full
+ */
+static void*
+mem_pool_alloc(size_t size) {
+    mem_pool_t* pool;
+    uint8_t* block;
+    
+    for (pool = MemPools; pool < &MemPools[GUI_COUNT_OF(MemPools)] && size > pool->BlockSize; pool++);
+    if (!size || pool == &MemPools[GUI_COUNT_OF(MemPools)] || pool->Memory == NULL) {  /* Memory of pool is not reserved */
+        return NULL;
+    }
+    if ((block = pool->FreeBlock) == NULL) {        /* Pool is full, use heap */
+        pool->Fallbacks++;
+        return NULL;
+    }
+    pool->FreeBlock = *(void **)block;
+    if (++pool->Used > pool->MaxUsed) {
+        pool->MaxUsed = pool->Used;
+    }
+    return block;
+}
+
+/**
+ * \brief           Find pool which owns memory
+ * \param[in]       ptr: Pointer to memory
+ * \return          Pool of memory or `NULL` when memory is not in any pool
+ */
+static mem_pool_t*
+mem_pool_find(const void* ptr) {
+    mem_pool_t* pool;
+    
+    for (pool = MemPools; pool < &MemPools[GUI_COUNT_OF(MemPools)]; pool++) {
+        if (pool->Memory != NULL && (const uint8_t *)ptr >= pool->Memory
+            && (const uint8_t *)ptr < &pool->Memory[pool->Blocks * MEM_POOL_STRIDE(pool)]) {
+            return pool;
+        }
+    }
+    return NULL;
+}
+
+/* Return block back to pool */
+static void
+mem_pool_free(mem_pool_t* pool, void* ptr) {
+    *(void **)ptr = pool->FreeBlock;
+    pool->FreeBlock = ptr;
+    pool->Used--;
+}
+
+#endif /* GUI_CFG_USE_MEM_POOLS || __DOXYGEN__ */
+
 /**
  * \brief           Allocate memory of specific size
  * \note            The function is private and can be called only when GUI protection against multiple access is activated
@@ -379,11 +1104,14 @@ void*
 gui_mem_alloc(uint32_t size) {
     void* ptr;
     __GUI_SYS_PROTECT();                            /* Lock system protection */
-#if GUI_CFG_USE_MEM
-    ptr = mem_alloc(size);                          /* Allocate memory and return pointer */ 
+#if GUI_CFG_USE_MEM_POOLS
+    ptr = mem_pool_alloc(size);                     /* Small objects are taken from pools */
+    if (ptr == NULL) {
+        ptr = mem_heap_alloc(size, GUI_MEM_CLASS_META); /* Allocate memory and return pointer */
+    }
 #else
-    ptr = malloc(size);
-#endif
+    ptr = mem_heap_alloc(size, GUI_MEM_CLASS_META); /* Allocate memory and return pointer */
+#endif /* GUI_CFG_USE_MEM_POOLS */
     __GUI_SYS_UNPROTECT();                          /* Unlock protection */
     return ptr;
 }
@@ -394,12 +1122,36 @@ gui_mem_alloc(uint32_t size) {
  *
  * \note            The function is private and can be called only when GUI protection against multiple access is activated
  * \param[in]       ptr: Pointer to current allocated memory to resize, returned using \ref gui_mem_alloc, \ref gui_mem_calloc or \ref gui_mem_realloc functions
- * \param[in]       size: Number of bytes to allocate on new memory
+ * \param[in]       size: Number of bytes to allocate on new memory. When `0`, memory is freed and `NULL` is returned
  * \return          Allocated memory on success, NULL otherwise
  */
 void*
 gui_mem_realloc(void* ptr, size_t size) {
+#if GUI_CFG_USE_MEM_POOLS
+    mem_pool_t* pool;
+    void* newPtr;
+#endif /* GUI_CFG_USE_MEM_POOLS */
+    if (ptr != NULL && !size) {                     /* Zero size frees memory, also for pool blocks */
+        gui_mem_free(ptr);
+        return NULL;
+    }
     __GUI_SYS_PROTECT();                            /* Lock system protection */
+#if GUI_CFG_USE_MEM_POOLS
+    if (ptr != NULL && (pool = mem_pool_find(ptr)) != NULL) {   /* Memory is in pool */
+        if (size > pool->BlockSize) {               /* Block is too small for new size */
+            if ((newPtr = mem_pool_alloc(size)) == NULL) {
+                newPtr = mem_heap_alloc(size, GUI_MEM_CLASS_META);
+            }
+            if (newPtr != NULL) {
+                memcpy(newPtr, ptr, pool->BlockSize);   /* Copy old data to new memory */
+                mem_pool_free(pool, ptr);
+            }
+            ptr = newPtr;
+        }
+        __GUI_SYS_UNPROTECT();                      /* Unlock protection */
+        return ptr;
+    }
+#endif /* GUI_CFG_USE_MEM_POOLS */
 #if GUI_CFG_USE_MEM
     ptr = mem_realloc(ptr, size);                   /* Reallocate and return pointer */
 #else
@@ -418,13 +1170,39 @@ gui_mem_realloc(void* ptr, size_t size) {
  */
 void*
 gui_mem_calloc(size_t num, size_t size) {
+    return gui_mem_calloc_class(num, size, GUI_MEM_CLASS_META);
+}
+
+/**
+ * \brief           Allocate memory for specific class of data and set memory to zero
+ *
+ *                  Memory is taken from regions in order defined by allocation class
+ *                  and region flags set in \ref gui_mem_assignmemory function.
+ *                  Only \ref GUI_MEM_CLASS_META allocations are taken from fixed size block pools.
+ *
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       num: Number of elements to allocate
+ * \param[in]       size: Size of each element
+ * \param[in]       cls: Allocation class, member of \ref gui_mem_class_t enumeration
+ * \return          Allocated memory on success, NULL otherwise
+ */
+void*
+gui_mem_calloc_class(size_t num, size_t size, gui_mem_class_t cls) {
     void* ptr;
     __GUI_SYS_PROTECT();                            /* Lock system protection */
+#if GUI_CFG_USE_MEM_POOLS
+    if (cls == GUI_MEM_CLASS_META && (ptr = mem_pool_alloc(num * size)) != NULL) { /* Small objects are taken from pools */
+        memset(ptr, 0x00, num * size);
+    } else
+#endif /* GUI_CFG_USE_MEM_POOLS */
+    {
 #if GUI_CFG_USE_MEM
-    ptr = mem_calloc(num, size);                   /* Allocate memory and clear it to 0. Then return pointer */
+        ptr = mem_calloc(num, size, cls);           /* Allocate memory and clear it to 0. Then return pointer */
 #else
-    ptr = calloc(num, size);
+        GUI_UNUSED(cls);
+        ptr = calloc(num, size);
 #endif
+    }
     __GUI_SYS_UNPROTECT();                          /* Unlock protection */
     return ptr;
 }
@@ -435,12 +1213,18 @@ gui_mem_calloc(size_t num, size_t size) {
  */
 void
 gui_mem_free(void* ptr) {
+#if GUI_CFG_USE_MEM_POOLS
+    mem_pool_t* pool;
+#endif /* GUI_CFG_USE_MEM_POOLS */
     __GUI_SYS_PROTECT();                            /* Lock system protection */
-#if GUI_CFG_USE_MEM
-    mem_free(ptr);                                  /* Free already allocated memory */
-#else
-    free(ptr);
-#endif
+#if GUI_CFG_USE_MEM_POOLS
+    if (ptr != NULL && (pool = mem_pool_find(ptr)) != NULL) {   /* Return block to its pool */
+        mem_pool_free(pool, ptr);
+    } else
+#endif /* GUI_CFG_USE_MEM_POOLS */
+    {
+        mem_heap_free(ptr);                         /* Free already allocated memory */
+    }
     __GUI_SYS_UNPROTECT();                          /* Unlock protection */
 }
 
@@ -474,18 +1258,119 @@ gui_mem_getminfree(void) {
     return mem_getminfree();                        /* Get minimal number of bytes ever available for allocation */
 }
 
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+
+/**
+ * \brief           Get counters of reallocation paths
+ * \note            Reallocations of blocks in pools are not counted
+ * \param[out]      stats: Pointer to \ref gui_mem_realloc_stats_t structure to fill
+ */
+void
+gui_mem_getreallocstats(gui_mem_realloc_stats_t* stats) {
+    __GUI_SYS_PROTECT();                            /* Lock system protection */
+    *stats = MemReallocStats;
+    __GUI_SYS_UNPROTECT();                          /* Unlock protection */
+}
+
+/**
+ * \brief           Get statistics of memory region
+ * \param[in]       index: Region index in list passed to \ref gui_mem_assignmemory
+ * \param[out]      info: Pointer to \ref gui_mem_region_info_t structure to fill
+ * \return          `1` on success, `0` when region does not exist
+ */
+uint8_t
+gui_mem_getregioninfo(size_t index, gui_mem_region_info_t* info) {
+    const mem_heap_t* heap;
+    
+    if (index >= MemHeapsCount || info == NULL) {
+        return 0;
+    }
+    heap = &MemHeaps[index];
+    __GUI_SYS_PROTECT();                            /* Lock system protection */
+    info->size = heap->Total;
+    info->free = heap->Available;
+    info->min_free = heap->MinAvailable;
+    info->flags = heap->Flags;
+    __GUI_SYS_UNPROTECT();                          /* Unlock protection */
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+
 /**
  * \brief           Assign memory region(s) for allocation functions
  * \note            You can allocate multiple regions by assigning start address and region size in units of bytes
- * \param[in]       regions: Pointer to list of regions to use for allocations
- * \param[in]       len: Number of regions to use
- * \return          `1` on success, `0` otherwise
+ *
+ *                  Each region has its own heap. Region flags select which allocation classes use region first,
+ *                  see \ref gui_mem_calloc_class function.
+ *
+ *                  Memory of block pools is reserved at the start of first region used for \ref GUI_MEM_CLASS_META
+ *                  allocations when \ref GUI_CFG_USE_MEM_POOLS is enabled.
+ *
+ * \param[in]       regions: Pointer to list of regions to use for allocations, sorted by start address
+ * \param[in]       len: Number of regions to use, up to \ref GUI_CFG_MEM_MAX_REGIONS
+ * \return          `1` on success, `0` otherwise. When pools do not fit to memory, no region is assigned
  */
 uint8_t
 gui_mem_assignmemory(const GUI_MEM_Region_t* regions, size_t len) {
     uint8_t ret;
     __GUI_SYS_PROTECT();                            /* Enter GUI */
     ret = mem_assignmem(regions, len);              /* Assign memory */
+#if GUI_CFG_USE_MEM_POOLS && GUI_CFG_USE_MEM
+    if (ret && !mem_pool_reserve()) {               /* Pools are placed before any other allocation */
+        mem_pool_unreserve();
+        memset(MemHeaps, 0x00, sizeof(MemHeaps));   /* Regions may be assigned again */
+        MemHeapsCount = 0;
+        MemAvailableBytes = 0;
+        MemMinAvailableBytes = 0;
+        MemTotalSize = 0;
+        ret = 0;
+    }
+#endif /* GUI_CFG_USE_MEM_POOLS && GUI_CFG_USE_MEM */
     __GUI_SYS_UNPROTECT();                          /* Leave GUI */
     return ret;                                     
 }
+
+#if GUI_CFG_USE_MEM_POOLS || __DOXYGEN__
+
+/**
+ * \brief           Reserve memory of fixed size block pools
+ * \note            Called by \ref gui_init. With \ref GUI_CFG_USE_MEM enabled,
+ *                      pools are already reserved by \ref gui_mem_assignmemory
+ * \return          `1` when memory of all pools is reserved, `0` otherwise
+ */
+uint8_t
+gui_mem_reservepools(void) {
+    uint8_t ret;
+    __GUI_SYS_PROTECT();                            /* Lock system protection */
+    ret = mem_pool_reserve();
+    __GUI_SYS_UNPROTECT();                          /* Unlock protection */
+    return ret;
+}
+
+/**
+ * \brief           Get occupancy of fixed size block pool
+ * \note            Pools are defined with \ref GUI_CFG_MEM_POOLS configuration
+ * \param[in]       index: Pool index in configuration list
+ * \param[out]      info: Pointer to \ref gui_mem_pool_info_t structure to fill
+ * \return          `1` on success, `0` when pool does not exist
+ */
+uint8_t
+gui_mem_getpoolinfo(size_t index, gui_mem_pool_info_t* info) {
+    const mem_pool_t* pool;
+    
+    if (index >= GUI_COUNT_OF(MemPools) || info == NULL) {
+        return 0;
+    }
+    pool = &MemPools[index];
+    __GUI_SYS_PROTECT();                            /* Lock system protection */
+    info->block_size = pool->BlockSize;
+    info->blocks = pool->Memory != NULL ? pool->Blocks : 0;
+    info->used = pool->Used;
+    info->max_used = pool->MaxUsed;
+    info->fallbacks = pool->Fallbacks;
+    __GUI_SYS_UNPROTECT();                          /* Unlock protection */
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM_POOLS || __DOXYGEN__ */
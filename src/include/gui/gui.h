@@ -103,6 +103,15 @@ extern "C" {
  */
 #define GUI_MEMALLOC(size)          gui_mem_calloc(size, 1)
 
+/**
+ * \brief           Allocate memory with specific size in bytes for specific class of data
+ * \note            Memory is reset to zero
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       cls: Allocation class, member of \ref gui_mem_class_t enumeration
+ * \hideinitializer
+ */
+#define GUI_MEMALLOC_CLASS(size, cls)   gui_mem_calloc_class(size, 1, cls)
+
 /**
  * \brief           Reallocate memory with specific size in bytes
  * \hideinitializer
@@ -198,6 +207,9 @@ extern "C" {
 guir_t  gui_init(void);
 int32_t gui_process(void);
 uint8_t gui_seteventcallback(gui_eventcallback_t cb);
+#if GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__
+uint8_t gui_getscratchstats(gui_scratch_stats_t* stats);
+#endif /* GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__ */
  
 /**
  * \}
@@ -145,6 +145,59 @@
 #define GUI_CFG_MEM_ALIGNMENT                   4
 #endif
 
+/**
+ * \brief           Enables (1) or disables (0) Two-Level Segregated Fit allocation algorithm
+ *
+ *                  When enabled, free blocks are kept in lists by size class and
+ *                  allocation and free take constant time regardless of fragmentation.
+ *                  When disabled, first-fit algorithm with single list of free blocks is used.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM is enabled
+ */
+#ifndef GUI_CFG_MEM_TLSF
+#define GUI_CFG_MEM_TLSF                        0
+#endif
+
+/**
+ * \brief           Maximal number of memory regions passed to \ref gui_mem_assignmemory
+ *
+ *                  Each region has its own heap and statistics
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM is enabled
+ */
+#ifndef GUI_CFG_MEM_MAX_REGIONS
+#define GUI_CFG_MEM_MAX_REGIONS                 4
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) pools of fixed size blocks for small objects
+ *
+ *                  Allocations which fit to block of any pool in \ref GUI_CFG_MEM_POOLS,
+ *                  such as widget handles, timers, list items and linked list entries,
+ *                  are taken from pool instead of heap. When pool is full, heap is used.
+ *                  Use \ref gui_mem_getpoolinfo to get pool occupancy.
+ *
+ * \note            Disabled by default, as pool memory stays reserved even when unused.
+ *                      Enable it after \ref GUI_CFG_MEM_POOLS is sized for application
+ */
+#ifndef GUI_CFG_USE_MEM_POOLS
+#define GUI_CFG_USE_MEM_POOLS                   0
+#endif
+
+/**
+ * \brief           List of fixed size block pools as `{block size, number of blocks}` pairs
+ *
+ *                  Allocation is taken from first pool with block size equal or greater than required size,
+ *                  therefore pools must be sorted by block size.
+ *                  Memory of all pools is reserved from heap when memory regions are assigned and is never released.
+ *                  \ref gui_init fails when pools do not fit to memory.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_POOLS is enabled
+ */
+#ifndef GUI_CFG_MEM_POOLS
+#define GUI_CFG_MEM_POOLS                       {16, 32}, {32, 64}, {64, 32}, {256, 32}
+#endif
+
 /**
  * \brief           Enables (1) or disables (0) transparency option for widgets
  *
@@ -154,6 +207,139 @@
 #define GUI_CFG_USE_TRANSPARENCY                0
 #endif
 
+/**
+ * \brief           Size of scratch memory in units of bytes for virtual layers of transparent widgets
+ *
+ *                  Transparent widget is drawn to virtual layer taken from scratch memory
+ *                  and blended to layer below. Nested transparent widgets take their layers one after another.
+ *                  Memory is allocated in \ref gui_init and is enlarged between redraws to peak required size
+ *                  when it is too small, widgets which could not get layer are redrawn afterwards.
+ *
+ * \note            Set to `0` to allocate memory on first redraw of transparent widget.
+ *                  Used only when \ref GUI_CFG_USE_TRANSPARENCY is enabled
+ */
+#ifndef GUI_CFG_TRANSPARENCY_BUFFER_SIZE
+#define GUI_CFG_TRANSPARENCY_BUFFER_SIZE        0
+#endif
+
+/**
+ * \brief           Maximal number of separate invalid (dirty) regions redrawn in single frame
+ *
+ *                  When list of regions is full and new region cannot be merged to existing one,
+ *                  all regions are merged to single bounding box covering all of them.
+ *
+ * \note            Set to `1` to always use single bounding box for redraw
+ */
+#ifndef GUI_CFG_DISPLAY_REGIONS
+#define GUI_CFG_DISPLAY_REGIONS                 4
+#endif
+
+/**
+ * \brief           Maximal distance in units of pixels between 2 invalid regions to merge them together
+ *
+ *                  Regions which overlap or are closer than this value are merged to single region
+ *                  to prevent many small drawing operations on nearby areas
+ */
+#ifndef GUI_CFG_DISPLAY_REGIONS_MERGE_DIST
+#define GUI_CFG_DISPLAY_REGIONS_MERGE_DIST      16
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) rendering to partial frame buffer
+ *
+ *                  When enabled, low-level driver provides single layer with buffer smaller than screen
+ *                  and sets its size in bytes to \ref gui_lcd_t.buffer_size.
+ *                  Invalid regions are drawn in horizontal bands which fit to buffer
+ *                  and each band is sent to LCD with \ref gui_ll_t.Flush function.
+ *
+ * \note            Buffer must be big enough for at least one full line of screen,
+ *                  otherwise \ref gui_init returns \ref guiERROR
+ */
+#ifndef GUI_CFG_USE_PARTIAL_BUFFER
+#define GUI_CFG_USE_PARTIAL_BUFFER              0
+#endif
+
+/**
+ * \brief           Maximal memory in units of bytes used for font character cache
+ *
+ *                  Characters are converted to alpha only format and stored in RAM
+ *                  for fast copy with \ref gui_ll_t.CopyChar function.
+ *                  When limit is reached, least recently used characters are removed from cache.
+ */
+#ifndef GUI_CFG_FONT_CACHE_SIZE
+#define GUI_CFG_FONT_CACHE_SIZE                 0x4000
+#endif
+
+/**
+ * \brief           Number of hash buckets for font character cache lookup
+ *
+ * \note            Value must be power of 2
+ */
+#ifndef GUI_CFG_FONT_CACHE_HASH_SIZE
+#define GUI_CFG_FONT_CACHE_HASH_SIZE            64
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) cached layout of widget text
+ *
+ *                  When enabled, line breaks and line widths of widget text are calculated only once
+ *                  and reused on next redraws until text, font or drawing rectangle width changes.
+ */
+#ifndef GUI_CFG_USE_TEXT_LAYOUT_CACHE
+#define GUI_CFG_USE_TEXT_LAYOUT_CACHE           1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) SIMD kernels in software rendering low-level driver
+ *
+ *                  When enabled, SSE2, AVX2 or NEON kernels are used when compiler target supports them.
+ *                  With GCC or Clang on x86, AVX2 kernels are selected at run time when CPU supports them.
+ *
+ * \note            Used only with \ref GUI_LL_SOFT module
+ */
+#ifndef GUI_CFG_LL_SOFT_SIMD
+#define GUI_CFG_LL_SOFT_SIMD                    1
+#endif
+
+/**
+ * \brief           Maximal number of drawing operations collected to single low-level batch call
+ *
+ *                  When low-level driver implements \ref gui_ll_t.FillRects or \ref gui_ll_t.CopyChars,
+ *                  consecutive fills or character copies with the same color are collected
+ *                  and sent to driver with single call.
+ *
+ * \note            Set to `0` to disable batching
+ */
+#ifndef GUI_CFG_LL_BATCH_SIZE
+#define GUI_CFG_LL_BATCH_SIZE                   16
+#endif
+
+/**
+ * \brief           Size of scratch buffer in units of bytes for composing text lines
+ *
+ *                  When set, visible characters of each text line are copied from font cache
+ *                  to alpha only scratch buffer with CPU and line is drawn with single
+ *                  \ref gui_ll_t.CopyChar call for each color instead of one call per character.
+ *                  Buffer is allocated on first use and used as ring for consecutive lines.
+ *
+ * \note            Set to `0` to draw characters one by one
+ */
+#ifndef GUI_CFG_TEXT_LINE_BUFFER_SIZE
+#define GUI_CFG_TEXT_LINE_BUFFER_SIZE           0
+#endif
+
+/**
+ * \brief           Size of buffer in units of bytes for lines of compressed image
+ *
+ *                  Visible lines of \ref GUI_IMAGE_FLAG_RLE images and of L4 images starting on odd column
+ *                  are decoded to buffer and drawn with single low-level call for all lines which fit to buffer.
+ *                  Buffer is allocated on first use and kept for next images.
+ *                  It always holds at least one visible line and is enlarged for wider lines.
+ */
+#ifndef GUI_CFG_IMAGE_DECODE_BUFFER_SIZE
+#define GUI_CFG_IMAGE_DECODE_BUFFER_SIZE        0x400
+#endif
+
 /**
  * \}
  */
@@ -74,6 +74,7 @@ extern "C" {
 #define GUI_FLAG_TOUCH_MOVE                 ((uint32_t)0x00008000)  /*!< Indicates widget callback has processed touch move event. This parameter works in conjunction with \ref GUI_FLAG_ACTIVE flag */
 #define GUI_FLAG_XPOS_PERCENT               ((uint32_t)0x00010000)  /*!< Indicates widget X position is in percent relative to parent width */
 #define GUI_FLAG_YPOS_PERCENT               ((uint32_t)0x00020000)  /*!< Indicates widget Y position is in percent relative to parent height */
+#define GUI_FLAG_COVERED                    ((uint32_t)0x00400000)  /*!< Indicates widget is fully covered by opaque widgets above it in currently redrawn region */
 
 /**
  * \defgroup        GUI_WIDGETS_CORE_FLAGS Widget type flags
@@ -84,12 +85,14 @@ extern "C" {
 #define GUI_FLAG_WIDGET_ALLOW_CHILDREN      ((uint32_t)0x00040000)  /*!< Widget allows children widgets */
 #define GUI_FLAG_WIDGET_DIALOG_BASE         ((uint32_t)0x00080000)  /*!< Widget is dialog base. When it is active, no other widget around dialog can be pressed */
 #define GUI_FLAG_WIDGET_INVALIDATE_PARENT   ((uint32_t)0x00100000)  /*!< Anytime widget is invalidated, parent should be invalidated too */
+#define GUI_FLAG_WIDGET_OPAQUE              ((uint32_t)0x00200000)  /*!< Widget draws every pixel of its area with opaque colors. Widgets fully covered by it are not redrawn */
 
 /**
  * \}
  */
 
 #define GUI_FLAG_LCD_WAIT_LAYER_CONFIRM     ((uint32_t)0x00000001)  /*!< Indicates waiting for layer change confirmation */
+#define GUI_FLAG_LCD_CPU_ACCESS             ((uint32_t)0x00000002)  /*!< Layers are ARGB8888 or RGB565 frame buffers CPU may write, set by low-level driver */
 
 /**
  * \}
@@ -291,14 +294,23 @@ typedef struct {
     gui_dim_t y2;                           /*!< Clipping area end Y */
 } gui_display_t;
 
+/**
+ * \brief           List of clipping regions
+ * \sa              GUI_CFG_DISPLAY_REGIONS
+ */
+typedef struct {
+    gui_display_t regions[GUI_CFG_DISPLAY_REGIONS]; /*!< List of clipping regions */
+    size_t count;                           /*!< Number of used regions in list */
+} gui_display_list_t;
+
 /**
  * \brief           LCD layer structure
  */
 typedef struct {
     uint8_t num;                            /*!< Layer number */
-    uint32_t start_address;                 /*!< Start address in memory if it exists */
+    uintptr_t start_address;                /*!< Start address in memory if it exists */
     volatile uint8_t pending;               /*!< Layer pending for redrawing operation */
-    gui_display_t display;                  /*!< Display setup for clipping regions for main layers (no virtual) */
+    gui_display_list_t missed;              /*!< Regions redrawn on other layers since this layer was last drawn (main layers only, no virtual) */
     
     gui_dim_t width;                        /*!< Layer width, used for virtual layers mainly */
     gui_dim_t height;                       /*!< Layer height, used for virtual layers mainly */
@@ -318,8 +330,20 @@ typedef struct {
     size_t layer_count;                     /*!< Number of layers used for LCD and drawings */
     gui_layer_t* layers;                    /*!< Pointer to layers */
     uint32_t flags;                         /*!< List of flags */
+#if GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__
+    size_t buffer_size;                     /*!< Size of partial drawing buffer of first layer in units of bytes */
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__ */
 } gui_lcd_t;
 
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Visible part of single image line
+ */
+typedef struct {
+    uint16_t x1;                            /*!< First pixel in line which is not fully transparent */
+    uint16_t x2;                            /*!< Pixel after last pixel which is not fully transparent. Set equal to `x1` when line is fully transparent */
+} gui_image_row_t;
+
 /**
  * \ingroup         GUI_IMAGE
  * \brief           Image descriptor structure
@@ -327,10 +351,73 @@ typedef struct {
 typedef struct {
     gui_dim_t x_size;                       /*!< Image X size */
     gui_dim_t y_size;                       /*!< Image Y size */
-    uint8_t bpp;                            /*!< Bits per pixel */
+    uint8_t bpp;                            /*!< Bits per pixel. Values `8` (L8) and `4` (L4) are indexes to palette.
+                                                    L4 image has 2 pixels per byte with first pixel in low nibble and each line starts on new byte */
     const uint8_t* image;                   /*!< Pointer to image byte array */
+    uint8_t flags;                          /*!< List of image flags */
+    const gui_color_t* palette;             /*!< Pointer to palette of ARGB8888 colors for L8 and L4 images */
+    uint16_t palette_size;                  /*!< Number of colors in palette, up to `256` for L8 and `16` for L4 image */
+    const gui_image_row_t* rows;            /*!< Optional table of visible part for each line, used to skip transparent borders.
+                                                    Not used for \ref GUI_IMAGE_FLAG_RLE and L4 images */
+    uint8_t palette_gen;                    /*!< Palette generation. Drivers may keep last palette loaded, change this value
+                                                    after palette colors are modified in place to force palette load on next draw */
 } gui_image_desc_t;
 
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Image data are compressed with run-length encoding
+ *
+ *                  Image array starts with table of \ref gui_image_desc_t.y_size 32-bit little endian offsets,
+ *                  one for each line, from start of array to first packet of line.
+ *                  Each line is encoded separately as list of packets. Packet starts with header byte,
+ *                  where lower 7 bits plus `1` is number of pixels in packet:
+ *
+ *                      - When bit 7 is set, header is followed by single pixel repeated for all packet pixels
+ *                      - When bit 7 is cleared, header is followed by all packet pixels
+ *
+ *                  Pixels are stored in the same format as in uncompressed image.
+ *                  Only visible part of image is decoded on each draw.
+ *
+ * \note            Supported for images with `8` or more bits per pixel,
+ *                      \ref gui_draw_image does not draw L4 image with this flag
+ */
+#define GUI_IMAGE_FLAG_RLE              ((uint8_t)0x01)
+
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Color channels of 32-bit image are premultiplied with alpha
+ *
+ *                  Pixels are stored in the same byte order as in normal 32-bit image,
+ *                  but each color channel is already multiplied with alpha and may not be greater than alpha.
+ *                  Blending needs only one multiply-add per channel and
+ *                  fully transparent or fully opaque pixels are not blended at all.
+ */
+#define GUI_IMAGE_FLAG_PREMULTIPLIED    ((uint8_t)0x02)
+
+/**
+ * \brief           Rectangle for batched fill operation, in layer coordinates
+ * \sa              gui_ll_t.FillRects
+ */
+typedef struct {
+    gui_dim_t x;                            /*!< Top left X position on layer */
+    gui_dim_t y;                            /*!< Top left Y position on layer */
+    gui_dim_t width;                        /*!< Rectangle width */
+    gui_dim_t height;                       /*!< Rectangle height */
+} gui_ll_rect_t;
+
+/**
+ * \brief           Character for batched copy operation with alpha only source
+ * \sa              gui_ll_t.CopyChars
+ */
+typedef struct {
+    const void* src;                        /*!< Pointer to alpha only source data */
+    void* dst;                              /*!< Pointer to destination on layer */
+    gui_dim_t width;                        /*!< Area width */
+    gui_dim_t height;                       /*!< Area height */
+    gui_dim_t offlinesrc;                   /*!< Number of bytes to skip in source after each line */
+    gui_dim_t offlinedst;                   /*!< Number of pixels to skip in destination after each line */
+} gui_ll_char_t;
+
 /**
  * \brief           Low-level LCD command enumeration
  */
@@ -357,7 +444,7 @@ typedef enum {
  */
 typedef struct gui_ll_t {
     void            (*Init)         (gui_lcd_t *);                                                                      /*!< Pointer to LCD initialization function */
-    uint8_t         (*IsReady)      (gui_lcd_t *);                                                                      /*!< Pointer to LCD is ready function */
+    uint8_t         (*IsReady)      (gui_lcd_t *);                                                                      /*!< Pointer to LCD is ready function. Returns 1 when all queued drawing operations are finished */
     void            (*SetPixel)     (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t, gui_color_t);                    /*!< Pointer to LCD set pixel function */
     gui_color_t     (*GetPixel)     (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t);                                 /*!< Pointer to read pixel from LCD */
     void            (*Fill)         (gui_lcd_t *, gui_layer_t *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t); /*!< Pointer to LCD fill screen or rectangle function */
@@ -368,8 +455,13 @@ typedef struct gui_ll_t {
     void            (*FillRect)     (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);  /*!< Pointer to function for filling rectangle on LCD */
     void            (*DrawImage16)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 16BPP (RGB565) images */
     void            (*DrawImage24)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 24BPP (RGB888) images */
-    void            (*DrawImage32)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 32BPP (ARGB8888) images */
+    void            (*DrawImage32)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 32BPP (ARGB8888) images, with straight or \ref GUI_IMAGE_FLAG_PREMULTIPLIED alpha */
     void            (*CopyChar)     (gui_lcd_t *, gui_layer_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);                /*!< Pointer to copy char function with alpha only as source */
+    void            (*Flush)        (gui_lcd_t *, gui_layer_t *);                                                       /*!< Pointer to function to send partial buffer to LCD. Layer offsets, width and height describe screen area of buffer */
+    void            (*FillRects)    (gui_lcd_t *, gui_layer_t *, const gui_ll_rect_t *, size_t, gui_color_t);            /*!< Pointer to function for filling list of rectangles with the same color. Set to 0 to use \ref gui_ll_t.FillRect for each rectangle */
+    void            (*CopyChars)    (gui_lcd_t *, gui_layer_t *, const gui_ll_char_t *, size_t, gui_color_t);            /*!< Pointer to function for copying list of characters with the same color. Set to 0 to use \ref gui_ll_t.CopyChar for each character */
+    void            (*CopyCharA4)   (gui_lcd_t *, gui_layer_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);                /*!< Pointer to copy char function with 4-bit alpha source, first pixel in low nibble. Source offline is in units of pixels and lines start on byte. Set to 0 to copy lines expanded on stack with \ref gui_ll_t.CopyChar */
+    void            (*DrawImageIndexed) (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, const void *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing L8 and L4 images with \ref gui_image_desc_t.palette. For L4, first pixel is in low nibble of first byte and source offline is in units of pixels */
 } gui_ll_t;
 
 /**
@@ -406,18 +498,76 @@ typedef struct {
 #define GUI_FLAG_FONT_RIGHTALIGN        ((uint8_t)0x02) /*!< Indicates right align text if string length is too wide for rectangle */
 #define GUI_FLAG_FONT_MULTILINE         ((uint8_t)0x04) /*!< Indicates multi line support on widget */
 #define GUI_FLAG_FONT_EDITMODE          ((uint8_t)0x08) /*!< Edit mode is enabled on text */
+#define GUI_FLAG_FONT_A4                ((uint8_t)0x10) /*!< Character data are 4-bit alpha values, 2 pixels per byte with first pixel in low nibble. Each line starts on new byte. Data are used for drawing without RAM cache */
+#define GUI_FLAG_FONT_A8                ((uint8_t)0x20) /*!< Character data are 8-bit alpha values, 1 byte per pixel. Data are used for drawing directly without RAM cache */
 
 #if defined(GUI_INTERNAL) || __DOXYGEN__
 /**
  * \brief           Char temporary entry stored in RAM for faster copy with blending operations
  */
-typedef struct {
-    gui_linkedlist_t list;                  /*!< Linked list entry. Must always be first on the list */
+typedef struct gui_font_charentry {
+    gui_linkedlist_t list;                  /*!< Linked list entry in LRU order. Must always be first on the list */
+    struct gui_font_charentry* next_hash;   /*!< Next entry in the same hash bucket */
     const gui_font_char_t* Ch;              /*!< Character value */
     const gui_font_t* Font;                 /*!< Pointer to font structure */
+    size_t size;                            /*!< Total size of entry with data in units of bytes */
 } gui_font_charentry_t;
 #endif /* defined(GUI_INTERNAL) || __DOXYGEN__ */
 
+/**
+ * \brief           Statistics of font character cache
+ * \sa              gui_draw_font_getcachestats
+ */
+typedef struct {
+    uint32_t hits;                          /*!< Number of characters found in cache */
+    uint32_t misses;                        /*!< Number of characters not found in cache */
+    uint32_t evictions;                     /*!< Number of characters removed from cache to free memory */
+    size_t size;                            /*!< Current size of cache in units of bytes */
+    size_t count;                           /*!< Current number of characters in cache */
+} gui_font_cache_stats_t;
+
+/**
+ * \brief           Statistics of scratch memory for virtual layers of transparent widgets
+ * \sa              gui_getscratchstats, GUI_CFG_TRANSPARENCY_BUFFER_SIZE
+ */
+typedef struct {
+    size_t size;                            /*!< Size of scratch memory in units of bytes */
+    size_t used;                            /*!< Number of bytes currently used by virtual layers */
+    size_t peak;                            /*!< Maximal number of bytes required at a time, greater than size when memory was too small */
+    uint32_t grows;                         /*!< Number of times memory was allocated or enlarged */
+    uint32_t fallbacks;                     /*!< Number of transparent widgets drawn without virtual layer because memory was too small */
+} gui_scratch_stats_t;
+
+/**
+ * \brief           Single line of text layout
+ */
+typedef struct {
+    size_t start;                           /*!< Offset of first character of line from start of text in units of bytes */
+    size_t count;                           /*!< Number of characters to draw in line */
+    gui_dim_t width;                        /*!< Width of line in units of pixels */
+} gui_text_layout_line_t;
+
+/**
+ * \brief           Cached result of text layout for drawing
+ *
+ *                  Layout is valid for text, font, width, line height and flags used when it was created.
+ *                  When any of these parameters changes, layout is created again on next draw.
+ * \sa              gui_draw_font_t
+ */
+typedef struct {
+    uint8_t valid;                          /*!< Set to `1` when layout is valid */
+    const gui_char* text;                   /*!< Text used for layout */
+    const gui_font_t* font;                 /*!< Font used for layout */
+    gui_dim_t width;                        /*!< Width of drawing rectangle used for layout */
+    gui_dim_t Lineheight;                   /*!< Line height used for layout */
+    uint8_t flags;                          /*!< Drawing flags used for layout */
+    gui_dim_t height;                       /*!< Total height of text in units of pixels */
+    gui_dim_t x_offset;                     /*!< X offset of text when right aligned text is wider than rectangle */
+    gui_text_layout_line_t* lines;          /*!< Pointer to allocated array of lines */
+    size_t count;                           /*!< Number of valid lines */
+    size_t size;                            /*!< Number of lines memory is allocated for */
+} gui_text_layout_t;
+
 #if !__DOXYGEN__
 #define ________                        0x00
 #define _______X                        0x01
@@ -1041,6 +1191,18 @@ typedef struct {
 
 #if defined(GUI_INTERNAL) || __DOXYGEN__
 
+/**
+ * \brief           Cached widget geometry in absolute screen coordinates
+ */
+typedef struct {
+    uint8_t valid;                          /*!< Set to `1` when cached values are valid */
+    gui_dim_t x;                            /*!< Absolute X position on screen */
+    gui_dim_t y;                            /*!< Absolute Y position on screen */
+    gui_dim_t width;                        /*!< Total width in units of pixels */
+    gui_dim_t height;                       /*!< Total height in units of pixels */
+    gui_display_t visible;                  /*!< Visible part of widget on screen, limited by all parent widgets */
+} gui_handle_geometry_t;
+
 /**
  * \brief           Common GUI values for widgets
  */
@@ -1062,10 +1224,14 @@ typedef struct gui_handle {
     uint8_t transparency;                   /*!< Widget transparency relative to parent widget */
 #endif /* GUI_CFG_USE_TRANSPARENCY */
     uint32_t flags;                         /*!< All possible flags for specific widget */
+    gui_handle_geometry_t geom;             /*!< Cached absolute geometry, calculated on first use after any change */
     gui_const gui_font_t* font;             /*!< Font used for widget drawings */
     gui_char* text;                         /*!< Pointer to widget text if exists */
     size_t textmemsize;                     /*!< Number of bytes for text when dynamically allocated */
     size_t textcursor;                      /*!< Text cursor position */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+    gui_text_layout_t textlayout;           /*!< Cached layout of widget text */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
     gui_timer_t* timer;                     /*!< Software timer pointer */
     gui_color_t* colors;                    /*!< Pointer to allocated color memory when custom colors are used */
     void* UserData;                         /*!< Pointer to optional user data */
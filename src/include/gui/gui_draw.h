@@ -159,6 +159,7 @@ typedef struct {
     gui_color_t color1;                     /*!< Color 1 */
     gui_color_t Color2;                     /*!< Color 2 */
     uint32_t Scrolly;                       /*!< Scroll in vertical direction */
+    gui_text_layout_t* layout;              /*!< Optional pointer to layout cache. When `NULL`, text layout is calculated on each draw */
 } gui_draw_font_t;
 
 /**
@@ -201,6 +202,15 @@ typedef struct {
     gui_dim_t y;                           /*!< Poly point Y location */
 } gui_draw_poly_t;
 
+/**
+ * \brief           Fill rule for filled polygons
+ * \sa              gui_draw_filledpoly
+ */
+typedef enum {
+    GUI_DRAW_POLY_RULE_EVENODD = 0x00,      /*!< Point is inside when ray from it crosses odd number of edges */
+    GUI_DRAW_POLY_RULE_NONZERO = 0x01,      /*!< Point is inside when winding number of edges around it is not zero */
+} gui_draw_poly_rule_t;
+
 void        gui_draw_font_init(gui_draw_font_t* f);
 void        gui_draw_fillscreen(const gui_display_t* disp, gui_color_t color);
 void        gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color_t color);
@@ -219,12 +229,19 @@ void        gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0,
 void         gui_draw_triangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1,  gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color);
 void        gui_draw_filledtriangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color);
 void        gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img);
+uint8_t     gui_draw_font_getcachestats(gui_font_cache_stats_t* stats);
 void        gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_char* str, gui_draw_font_t* draw);
 void        gui_draw_rectangle3d(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_draw_3d_state_t state);
 void        gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_color_t color);
+void        gui_draw_filledpoly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_draw_poly_rule_t rule, gui_color_t color);
 void        gui_draw_scrollbar_init(gui_draw_sb_t* sb);
 void        gui_draw_scrollbar(const gui_display_t* disp, gui_draw_sb_t* sb);
 
+#if defined(GUI_INTERNAL) && !__DOXYGEN__
+//Strictly private functions by GUI
+void        guii_draw_flush(void);
+#endif /* defined(GUI_INTERNAL) && !__DOXYGEN__ */
+
 /**
  * \}
  */
@@ -49,6 +49,14 @@ gui_dim_t  gui_lcd_getwidth(void);
 gui_dim_t  gui_lcd_getheight(void);
 void        gui_lcd_confirmactivelayer(uint8_t layer_num);
 
+#if defined(GUI_INTERNAL) && !__DOXYGEN__
+//Strictly private functions by GUI
+//Invalid regions management
+uint8_t     guii_lcd_region_add(gui_display_list_t* list, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2);
+//Low-level driver synchronization
+void        guii_ll_wait(void);
+#endif /* defined(GUI_INTERNAL) && !__DOXYGEN__ */
+
 /**
  * \}
  */
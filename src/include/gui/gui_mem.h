@@ -45,12 +45,34 @@ extern "C" {
  * \{
  */
 
+/**
+ * \brief           Class of allocated data, used to select memory region
+ */
+typedef enum {
+    GUI_MEM_CLASS_META = 0x00,          /*!< Small and frequently accessed data, such as widget handles and lists. Fast regions are used first */
+    GUI_MEM_CLASS_PIXEL,                /*!< Pixel and alpha buffers accessed by DMA. Regions with \ref GUI_MEM_REGION_NO_DMA flag are never used */
+    GUI_MEM_CLASS_BULK,                 /*!< Big and rarely accessed data, such as texts and graph data. Fast regions are used last */
+} gui_mem_class_t;
+
+/**
+ * \defgroup        GUI_MEM_REGION_FLAGS Memory region flags
+ * \brief           List of memory region flags
+ * \{
+ */
+#define GUI_MEM_REGION_FAST         ((uint8_t)0x01) /*!< Region is fast memory, such as TCM or internal SRAM */
+#define GUI_MEM_REGION_NO_DMA       ((uint8_t)0x02) /*!< Region is not reachable by DMA or graphics accelerator */
+
+/**
+ * \}
+ */
+
 /**
  * \brief           Single memory region descriptor
  */
 typedef struct mem_region_t {
     void* StartAddress;                 /*!< Start address of region */
     size_t Size;                        /*!< Size in units of bytes of region */
+    uint8_t Flags;                      /*!< Region flags, list of \ref GUI_MEM_REGION_FLAGS */
 } mem_region_t;
 
 /**
@@ -58,15 +80,54 @@ typedef struct mem_region_t {
  */
 typedef mem_region_t GUI_MEM_Region_t;
 
+/**
+ * \brief           Occupancy of fixed size block pool
+ */
+typedef struct {
+    size_t block_size;                  /*!< Maximal allocation size served by pool */
+    size_t blocks;                      /*!< Number of blocks in pool, `0` when pool memory is not reserved */
+    size_t used;                        /*!< Number of currently used blocks */
+    size_t max_used;                    /*!< Maximal number of used blocks at a time */
+    size_t fallbacks;                   /*!< Number of allocations done on heap because pool was full */
+} gui_mem_pool_info_t;
+
+/**
+ * \brief           Statistics of memory region
+ */
+typedef struct {
+    size_t size;                        /*!< Size of heap in region, `0` when region is too small to be used */
+    size_t free;                        /*!< Number of bytes available to allocate */
+    size_t min_free;                    /*!< Minimal number of bytes ever available */
+    uint8_t flags;                      /*!< Region flags, list of \ref GUI_MEM_REGION_FLAGS */
+} gui_mem_region_info_t;
+
+/**
+ * \brief           Counters of reallocation paths
+ */
+typedef struct {
+    size_t grow_in_place;               /*!< Number of reallocations grown to next free block without copy */
+    size_t shrink_in_place;             /*!< Number of reallocations to smaller or equal size done without copy */
+    size_t moved;                       /*!< Number of reallocations copied to new block */
+} gui_mem_realloc_stats_t;
+
 void* gui_mem_alloc(uint32_t size);
 void* gui_mem_realloc(void* ptr, size_t size);
 void* gui_mem_calloc(size_t num, size_t size);
+void* gui_mem_calloc_class(size_t num, size_t size, gui_mem_class_t cls);
 void gui_mem_free(void* ptr);
 size_t gui_mem_getfree(void);
 size_t gui_mem_getfull(void);
 size_t gui_mem_getminfree(void);
 
 uint8_t gui_mem_assignmemory(const GUI_MEM_Region_t* regions, size_t size);
+#if GUI_CFG_USE_MEM || __DOXYGEN__
+void gui_mem_getreallocstats(gui_mem_realloc_stats_t* stats);
+uint8_t gui_mem_getregioninfo(size_t index, gui_mem_region_info_t* info);
+#endif /* GUI_CFG_USE_MEM || __DOXYGEN__ */
+#if GUI_CFG_USE_MEM_POOLS || __DOXYGEN__
+uint8_t gui_mem_reservepools(void);
+uint8_t gui_mem_getpoolinfo(size_t index, gui_mem_pool_info_t* info);
+#endif /* GUI_CFG_USE_MEM_POOLS || __DOXYGEN__ */
     
 /**
  * \}
@@ -70,6 +70,22 @@ typedef struct {
 } GUI_OS_t;
 #endif /* GUI_CFG_OS */
 
+#if GUI_CFG_LL_BATCH_SIZE || __DOXYGEN__
+/**
+ * \brief           Drawing operations waiting to be sent to low-level driver as single batch
+ */
+typedef struct {
+    uint8_t type;                           /*!< Type of operations in batch */
+    gui_layer_t* layer;                     /*!< Layer operations are drawn to */
+    gui_color_t color;                      /*!< Color of all operations */
+    size_t count;                           /*!< Number of operations in batch */
+    union {
+        gui_ll_rect_t rects[GUI_CFG_LL_BATCH_SIZE]; /*!< List of rectangles to fill */
+        gui_ll_char_t chars[GUI_CFG_LL_BATCH_SIZE]; /*!< List of characters to copy */
+    } ops;                                  /*!< List of operations */
+} gui_ll_batch_t;
+#endif /* GUI_CFG_LL_BATCH_SIZE || __DOXYGEN__ */
+
 /**
  * \brief           GUI main object structure
  */
@@ -79,7 +95,10 @@ typedef struct {
     
     uint32_t flags;                         /*!< Core GUI flags management */
     
-    gui_display_t Display;                  /*!< Clipping management */
+    gui_display_t Display;                  /*!< Clipping region currently processed by redraw */
+    gui_display_list_t DisplayInvalid;      /*!< List of invalid regions waiting for next redraw */
+    gui_display_list_t DisplayRedraw;       /*!< List of regions processed in current redraw */
+    size_t DisplayRedrawIndex;              /*!< Index of currently processed region in redraw list */
     gui_display_t DisplayTemp;              /*!< Clipping for widgets for drawing and touch */
     
     gui_handle_p WindowActive;              /*!< Pointer to currently active window when creating new widgets */
@@ -89,7 +108,23 @@ typedef struct {
     gui_linkedlistroot_t root;              /*!< Root linked list of widgets */
     gui_timer_core_t timers;                /*!< Software structure management */
     
-    gui_linkedlistroot_t RootFonts;         /*!< Root linked list of font widgets */
+    gui_linkedlistroot_t RootFonts;         /*!< Root linked list of cached font characters, least recently used first */
+    gui_font_charentry_t* FontHash[GUI_CFG_FONT_CACHE_HASH_SIZE];   /*!< Hash buckets of cached font characters */
+    gui_font_cache_stats_t FontCache;       /*!< Font character cache statistics */
+    
+#if GUI_CFG_LL_BATCH_SIZE || __DOXYGEN__
+    gui_ll_batch_t Batch;                   /*!< Drawing operations waiting for low-level driver */
+#endif /* GUI_CFG_LL_BATCH_SIZE || __DOXYGEN__ */
+#if GUI_CFG_TEXT_LINE_BUFFER_SIZE || __DOXYGEN__
+    uint8_t* TextLineBuff;                  /*!< Scratch buffer for composing text lines */
+    size_t TextLinePos;                     /*!< Offset of free part of text line scratch buffer */
+#endif /* GUI_CFG_TEXT_LINE_BUFFER_SIZE || __DOXYGEN__ */
+    uint8_t* ImageDecodeBuff;               /*!< Buffer for decoded lines of compressed images */
+    size_t ImageDecodeSize;                 /*!< Size of image decode buffer in units of bytes */
+#if GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__
+    uint8_t* ScratchBuff;                   /*!< Scratch memory for virtual layers of transparent widgets */
+    gui_scratch_stats_t Scratch;            /*!< Scratch memory statistics */
+#endif /* GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__ */
     
     gui_widget_param_t WidgetParam;
     gui_widget_result_t WidgetResult;
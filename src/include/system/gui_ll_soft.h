@@ -0,0 +1,77 @@
+/**	
+ * \file            gui_ll_soft.h
+ * \brief           Software rendering low-level drawing functions
+ */
+ 
+/*
+ * Copyright (c) 2017 Tilen Majerle
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Author:          Tilen Majerle <tilen@majerle.eu>
+ */
+#ifndef __GUI_LL_SOFT_H
+#define __GUI_LL_SOFT_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \addtogroup      GUI_LL
+ * \{
+ */
+
+/**
+ * \defgroup        GUI_LL_SOFT Software rendering
+ * \brief           Drawing functions for frame buffers in CPU accessible memory
+ *
+ *                  Functions support ARGB8888 (pixel size of `4`) and RGB565 (pixel size of `2`) layers.
+ *                  Images use the same memory format as with DMA2D driver:
+ *                  red and blue components are swapped and alpha channel is inverted for 32BPP images.
+ *
+ *                  Blending kernels use SSE2, AVX2 or NEON instructions when available, see \ref GUI_CFG_LL_SOFT_SIMD
+ * \{
+ */
+
+#include "gui/gui.h"
+
+void    gui_ll_soft_init(gui_ll_t* LL);
+const char* gui_ll_soft_getkernelname(void);
+#if GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__
+void    gui_ll_soft_setscreen(void* addr);
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__ */
+
+/**
+ * \}
+ */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GUI_LL_SOFT_H */
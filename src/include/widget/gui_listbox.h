@@ -71,6 +71,9 @@ typedef enum {
 typedef struct {
     gui_linkedlist_t list;                  /*!< Linked list entry, must be first on list */
     gui_char* text;                         /*!< Text entry */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+    gui_text_layout_t layout;               /*!< Cached layout of item text */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
 } gui_listbox_item_t;
     
 /**
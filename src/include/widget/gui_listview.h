@@ -87,6 +87,9 @@ typedef struct {
     gui_linkedlist_t list;                  /*!< Linked list entry, must be first on list */
     gui_dim_t width;                       /*!< Column width in units of pixels */
     gui_char* text;                         /*!< Header column text size */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+    gui_text_layout_t layout;               /*!< Cached layout of header text */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
 } gui_listview_col_t;
 
 /**
@@ -95,6 +98,9 @@ typedef struct {
 typedef struct {
     gui_linkedlist_t list;                  /*!< Linked list entry, must be first on list */
     gui_char* text;                         /*!< Text entry */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+    gui_text_layout_t layout;               /*!< Cached layout of item text */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
 } gui_listview_item_t;
     
 /**
@@ -176,7 +176,7 @@ extern "C" {
  * \param[in]       x: Padding in byte format
  * \hideinitializer
  */
-#define guii_widget_setpaddingtop(h, x)              ((h)->padding = (uint32_t)(((h)->padding & 0x00FFFFFFUL) | (uint32_t)((uint8_t)(x)) << 24))
+#define guii_widget_setpaddingtop(h, x)              (guii_widget_resetgeometry(h), (h)->padding = (uint32_t)(((h)->padding & 0x00FFFFFFUL) | (uint32_t)((uint8_t)(x)) << 24))
 
 /**
  * \brief           Set right padding on widget
@@ -188,7 +188,7 @@ extern "C" {
  * \param[in]       x: Padding in byte format
  * \hideinitializer
  */
-#define guii_widget_setpaddingright(h, x)            ((h)->padding = (uint32_t)(((h)->padding & 0xFF00FFFFUL) | (uint32_t)((uint8_t)(x)) << 16))
+#define guii_widget_setpaddingright(h, x)            (guii_widget_resetgeometry(h), (h)->padding = (uint32_t)(((h)->padding & 0xFF00FFFFUL) | (uint32_t)((uint8_t)(x)) << 16))
 
 /**
  * \brief           Set bottom padding on widget
@@ -200,7 +200,7 @@ extern "C" {
  * \param[in]       x: Padding in byte format
  * \hideinitializer
  */
-#define guii_widget_setpaddingbottom(h, x)           ((h)->padding = (uint32_t)(((h)->padding & 0xFFFF00FFUL) | (uint32_t)((uint8_t)(x)) <<  8))
+#define guii_widget_setpaddingbottom(h, x)           (guii_widget_resetgeometry(h), (h)->padding = (uint32_t)(((h)->padding & 0xFFFF00FFUL) | (uint32_t)((uint8_t)(x)) <<  8))
 
 /**
  * \brief           Set left padding on widget
@@ -212,7 +212,7 @@ extern "C" {
  * \param[in]       x: Padding in byte format
  * \hideinitializer
  */
-#define guii_widget_setpaddingleft(h, x)             ((h)->padding = (uint32_t)(((h)->padding & 0xFFFFFF00UL) | (uint32_t)((uint8_t)(x)) <<  0))
+#define guii_widget_setpaddingleft(h, x)             (guii_widget_resetgeometry(h), (h)->padding = (uint32_t)(((h)->padding & 0xFFFFFF00UL) | (uint32_t)((uint8_t)(x)) <<  0))
 
 /**
  * \brief           Set top and bottom paddings on widget
@@ -509,6 +509,21 @@ extern "C" {
 #define guii_widget_gettransparency(h)              ((uint8_t)((h)->transparency))
 #endif /* GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__ */
 
+#if GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__
+/**
+ * \brief           Check if widget is opaque and fully covers widgets below it
+ * \note            Widget type must have \ref GUI_FLAG_WIDGET_OPAQUE flag and widget must not be transparent
+ *
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in,out]   h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ * \hideinitializer
+ */
+#define guii_widget_isopaque(h)                     (!!guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_OPAQUE) && !guii_widget_istransparent(h))
+#else
+#define guii_widget_isopaque(h)                     (!!guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_OPAQUE))
+#endif /* GUI_CFG_USE_TRANSPARENCY || __DOXYGEN__ */
+
 /**
  * \brief           Get z-index value from widget
  * \note            The function is private and can be called only when GUI protection against multiple access is activated
@@ -518,6 +533,59 @@ extern "C" {
  */
 #define guii_widget_getzindex(h)                   ((int32_t)((h)->zindex))
 
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+/**
+ * \brief           Get pointer to text layout cache of widget for \ref gui_draw_font_t.layout
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in,out]   h: Widget handle
+ * \return          Pointer to \ref gui_text_layout_t structure or `NULL` when cache is disabled
+ * \hideinitializer
+ */
+#define guii_widget_gettextlayout(h)                (&__GH(h)->textlayout)
+
+/**
+ * \brief           Invalidate cached text layout of widget
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in,out]   h: Widget handle
+ * \hideinitializer
+ */
+#define guii_widget_resettextlayout(h)              (__GH(h)->textlayout.valid = 0)
+
+/**
+ * \brief           Get pointer to text layout cache of widget item for \ref gui_draw_font_t.layout
+ * \note            Used by widgets with multiple texts, such as list items, which keep own \ref gui_text_layout_t per item
+ * \param[in,out]   l: Pointer to \ref gui_text_layout_t structure of item
+ * \return          Pointer to \ref gui_text_layout_t structure or `NULL` when cache is disabled
+ * \hideinitializer
+ */
+#define guii_textlayout_get(l)                      (l)
+
+/**
+ * \brief           Invalidate cached text layout of widget item
+ * \param[in,out]   l: Pointer to \ref gui_text_layout_t structure of item
+ * \hideinitializer
+ */
+#define guii_textlayout_reset(l)                    ((l)->valid = 0)
+
+/**
+ * \brief           Free memory of cached text layout of widget item
+ * \param[in,out]   l: Pointer to \ref gui_text_layout_t structure of item
+ * \hideinitializer
+ */
+#define guii_textlayout_free(l)                     do {    \
+    if ((l)->lines != NULL) {                               \
+        GUI_MEMFREE((l)->lines);                            \
+    }                                                       \
+    (l)->valid = 0;                                         \
+} while (0)
+#else
+#define guii_widget_gettextlayout(h)                NULL
+#define guii_widget_resettextlayout(h)
+#define guii_textlayout_get(l)                      NULL
+#define guii_textlayout_reset(l)
+#define guii_textlayout_free(l)
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
+
 gui_dim_t       guii_widget_getabsolutex(gui_handle_p h);
 gui_dim_t       guii_widget_getabsolutey(gui_handle_p h);
 gui_dim_t       guii_widget_getparentabsolutex(gui_handle_p h);
@@ -538,6 +606,7 @@ uint8_t         guii_widget_setheight(gui_handle_p h, gui_dim_t height);
 uint8_t         guii_widget_setwidthpercent(gui_handle_p h, float width);
 uint8_t         guii_widget_setheightpercent(gui_handle_p h, float height);
 uint8_t         guii_widget_set3dstyle(gui_handle_p h, uint8_t enable);
+void            guii_widget_resetgeometry(gui_handle_p h);
 uint8_t         guii_widget_setfont(gui_handle_p h, const gui_font_t* font);
 uint8_t         guii_widget_settext(gui_handle_p h, const gui_char* text);
 const gui_char*     guii_widget_gettext(gui_handle_p h);
@@ -721,7 +790,8 @@ uint8_t gui_widget_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* p
 void guii_widget_init(void);
 
 //Clipping regions
-uint8_t guii_widget_isinsideclippingregion(gui_handle_p h);
+uint8_t guii_widget_isinsideclippingregion(gui_handle_p h, const gui_display_t* disp);
+void guii_widget_updatecovered(gui_handle_p parent, const gui_display_t* disp);
 
 //Move widget down and all its parents with it
 void guii_widget_movedowntree(gui_handle_p h);
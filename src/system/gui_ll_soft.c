@@ -0,0 +1,975 @@
+/**	
+ * \file            gui_ll_soft.c
+ * \brief           Software rendering low-level drawing functions
+ */
+ 
+/*
+ * Copyright (c) 2017 Tilen Majerle
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Author:          Tilen Majerle <tilen@majerle.eu>
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "system/gui_ll_soft.h"
+
+/*
+ * Select available SIMD kernels at build time
+ */
+#if GUI_CFG_LL_SOFT_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LL_SOFT_SSE2                1
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define LL_SOFT_AVX2                1
+#define LL_SOFT_AVX2_FN
+#include <immintrin.h>
+#elif defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define LL_SOFT_AVX2                1
+#define LL_SOFT_AVX2_RUNTIME        1       /* Check CPU support at run time */
+#define LL_SOFT_AVX2_FN             __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif /* defined(__AVX2__) */
+#endif /* SSE2 available */
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LL_SOFT_NEON                1
+#include <arm_neon.h>
+#endif /* defined(__ARM_NEON) || defined(__ARM_NEON__) */
+#endif /* GUI_CFG_LL_SOFT_SIMD */
+
+/**
+ * \brief           Divide value between `0` and `255 * 255` by `255` with rounding
+ * \note            SIMD kernels use the same calculation to give equal results
+ * \hideinitializer
+ */
+#define DIV255(t)                   (((t) + 128 + (((t) + 128) >> 8)) >> 8)
+
+/**
+ * \brief           Set of row kernels for ARGB8888 and RGB565 layers
+ */
+typedef struct {
+    const char* name;                                                           /*!< Name of kernel set */
+    void (*Fill32)  (uint32_t* dst, size_t n, uint32_t color);                  /*!< Fill row with color */
+    void (*Fill16)  (uint16_t* dst, size_t n, uint16_t color);                  /*!< Fill row with color */
+    void (*Blend32) (uint32_t* dst, const uint32_t* src, size_t n, uint8_t a);  /*!< Blend row with constant alpha */
+    void (*Mask32)  (uint32_t* dst, const uint8_t* mask, size_t n, uint32_t color);    /*!< Blend color through alpha mask */
+    void (*Image32) (uint32_t* dst, const uint8_t* src, size_t n);              /*!< Blend row of 32BPP image */
+    void (*Image32P)(uint32_t* dst, const uint8_t* src, size_t n);              /*!< Blend row of 32BPP image with premultiplied alpha */
+} ll_soft_kernels_t;
+
+static ll_soft_kernels_t kernels;           /* Currently used kernels */
+#if GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__
+static uint8_t* screen;                     /* Screen frame buffer where partial buffer is flushed to */
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__ */
+
+/*******************************************/
+/**            Scalar kernels             **/
+/*******************************************/
+
+/**
+ * \brief           Blend opaque color over destination pixel with coverage
+ * \param[in]       d: Destination pixel in ARGB8888 format
+ * \param[in]       s: Source color in ARGB8888 format. Alpha channel is ignored
+ * \param[in]       a: Coverage of source color
+ * \return          Blended pixel
+ */
+static uint32_t
+blend_pixel32(uint32_t d, uint32_t s, uint32_t a) {
+    uint32_t ia = 255 - a, t, out;
+    
+    t = 255 * a + ((d >> 24) & 0xFF) * ia;
+    out = DIV255(t) << 24;
+    t = ((s >> 16) & 0xFF) * a + ((d >> 16) & 0xFF) * ia;
+    out |= DIV255(t) << 16;
+    t = ((s >> 8) & 0xFF) * a + ((d >> 8) & 0xFF) * ia;
+    out |= DIV255(t) << 8;
+    t = (s & 0xFF) * a + (d & 0xFF) * ia;
+    out |= DIV255(t);
+    return out;
+}
+
+/**
+ * \brief           Blend premultiplied color over destination pixel
+ * \param[in]       d: Destination pixel in ARGB8888 format
+ * \param[in]       s: Source color in ARGB8888 format, premultiplied with its alpha
+ * \param[in]       ia: Inverted alpha of source color
+ * \return          Blended pixel
+ */
+static uint32_t
+blend_premul32(uint32_t d, uint32_t s, uint32_t ia) {
+    uint32_t t, out;
+    
+    t = ((d >> 24) & 0xFF) * ia;
+    out = (((s >> 24) & 0xFF) + DIV255(t)) << 24;
+    t = ((d >> 16) & 0xFF) * ia;
+    out |= (((s >> 16) & 0xFF) + DIV255(t)) << 16;
+    t = ((d >> 8) & 0xFF) * ia;
+    out |= (((s >> 8) & 0xFF) + DIV255(t)) << 8;
+    t = (d & 0xFF) * ia;
+    out |= (s & 0xFF) + DIV255(t);
+    return out;
+}
+
+/**
+ * \brief           Convert 32BPP image pixel to ARGB8888 color with normal alpha
+ * \param[in]       p: Pointer to 4 bytes of image pixel in R, G, B, inverted A order
+ * \return          ARGB8888 color
+ */
+static uint32_t
+image32_to_color(const uint8_t* p) {
+    return (uint32_t)(255 - p[3]) << 24 | (uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2];
+}
+
+/**
+ * \brief           Convert ARGB8888 color to RGB565 format
+ */
+static uint16_t
+color_to_565(uint32_t c) {
+    return (uint16_t)((((c >> 19) & 0x1F) << 11) | (((c >> 10) & 0x3F) << 5) | ((c >> 3) & 0x1F));
+}
+
+/**
+ * \brief           Convert RGB565 pixel to ARGB8888 color
+ */
+static uint32_t
+color_from_565(uint16_t v) {
+    uint32_t r = (v >> 11) & 0x1F, g = (v >> 5) & 0x3F, b = v & 0x1F;
+    
+    return 0xFF000000UL | ((r << 3) | (r >> 2)) << 16 | ((g << 2) | (g >> 4)) << 8 | ((b << 3) | (b >> 2));
+}
+
+static void
+fill32_scalar(uint32_t* dst, size_t n, uint32_t color) {
+    while (n--) {
+        *dst++ = color;
+    }
+}
+
+static void
+fill16_scalar(uint16_t* dst, size_t n, uint16_t color) {
+    while (n--) {
+        *dst++ = color;
+    }
+}
+
+static void
+blend32_scalar(uint32_t* dst, const uint32_t* src, size_t n, uint8_t a) {
+    for (; n; n--, dst++, src++) {
+        *dst = blend_pixel32(*dst, *src, a);
+    }
+}
+
+static void
+mask32_scalar(uint32_t* dst, const uint8_t* mask, size_t n, uint32_t color) {
+    for (; n; n--, dst++, mask++) {
+        if (*mask == 0xFF) {                        /* Fully covered pixel */
+            *dst = color | 0xFF000000UL;
+        } else if (*mask) {
+            *dst = blend_pixel32(*dst, color, *mask);
+        }
+    }
+}
+
+static void
+image32_scalar(uint32_t* dst, const uint8_t* src, size_t n) {
+    uint32_t c;
+    
+    for (; n; n--, dst++, src += 4) {
+        c = image32_to_color(src);
+        *dst = blend_pixel32(*dst, c, c >> 24);
+    }
+}
+
+static void
+image32p_scalar(uint32_t* dst, const uint8_t* src, size_t n) {
+    for (; n; n--, dst++, src += 4) {
+        if (src[3] == 0) {                          /* Fully opaque pixel */
+            *dst = image32_to_color(src);
+        } else if (src[3] != 0xFF) {                /* Skip fully transparent pixel */
+            *dst = blend_premul32(*dst, image32_to_color(src), src[3]);
+        }
+    }
+}
+
+#if LL_SOFT_SSE2 || __DOXYGEN__
+/*******************************************/
+/**              SSE2 kernels             **/
+/*******************************************/
+
+/**
+ * \brief           Blend 4 source pixels over 4 destination pixels
+ * \param[in]       s: Source pixels with coverage in alpha channel
+ * \param[in]       d: Destination pixels
+ * \return          Blended pixels
+ */
+static __m128i
+over_sse2(__m128i s, __m128i d) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i opaque = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    __m128i sl, sh, dl, dh, al, ah;
+    
+    sl = _mm_unpacklo_epi8(s, zero);
+    sh = _mm_unpackhi_epi8(s, zero);
+    dl = _mm_unpacklo_epi8(d, zero);
+    dh = _mm_unpackhi_epi8(d, zero);
+    al = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sl, 0xFF), 0xFF); /* Broadcast alpha to all channels */
+    ah = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sh, 0xFF), 0xFF);
+    sl = _mm_or_si128(sl, opaque);                  /* Source color is opaque */
+    sh = _mm_or_si128(sh, opaque);
+    
+    sl = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(sl, al), _mm_mullo_epi16(dl, _mm_sub_epi16(c255, al))), c128);
+    sh = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(sh, ah), _mm_mullo_epi16(dh, _mm_sub_epi16(c255, ah))), c128);
+    sl = _mm_srli_epi16(_mm_add_epi16(sl, _mm_srli_epi16(sl, 8)), 8);
+    sh = _mm_srli_epi16(_mm_add_epi16(sh, _mm_srli_epi16(sh, 8)), 8);
+    return _mm_packus_epi16(sl, sh);
+}
+
+/**
+ * \brief           Convert 4 pixels of 32BPP image to ARGB8888 with normal alpha
+ */
+static __m128i
+image32_to_color_sse2(__m128i p) {
+    __m128i c;
+    
+    c = _mm_and_si128(p, _mm_set1_epi32(0x0000FF00));   /* Green stays */
+    c = _mm_or_si128(c, _mm_and_si128(_mm_srli_epi32(p, 16), _mm_set1_epi32(0x000000FF)));  /* Swap red and blue */
+    c = _mm_or_si128(c, _mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(0x000000FF)), 16));
+    return _mm_or_si128(c, _mm_andnot_si128(p, _mm_set1_epi32((int)0xFF000000UL)));  /* Invert alpha */
+}
+
+static void
+fill32_sse2(uint32_t* dst, size_t n, uint32_t color) {
+    const __m128i c = _mm_set1_epi32((int)color);
+    
+    for (; n >= 4; n -= 4, dst += 4) {
+        _mm_storeu_si128((__m128i *)dst, c);
+    }
+    fill32_scalar(dst, n, color);
+}
+
+static void
+fill16_sse2(uint16_t* dst, size_t n, uint16_t color) {
+    const __m128i c = _mm_set1_epi16((short)color);
+    
+    for (; n >= 8; n -= 8, dst += 8) {
+        _mm_storeu_si128((__m128i *)dst, c);
+    }
+    fill16_scalar(dst, n, color);
+}
+
+static void
+blend32_sse2(uint32_t* dst, const uint32_t* src, size_t n, uint8_t a) {
+    const __m128i alpha = _mm_set1_epi32((int)((uint32_t)a << 24));
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    __m128i s;
+    
+    for (; n >= 4; n -= 4, dst += 4, src += 4) {
+        s = _mm_or_si128(_mm_and_si128(_mm_loadu_si128((const __m128i *)src), rgb), alpha);
+        _mm_storeu_si128((__m128i *)dst, over_sse2(s, _mm_loadu_si128((const __m128i *)dst)));
+    }
+    blend32_scalar(dst, src, n, a);
+}
+
+static void
+mask32_sse2(uint32_t* dst, const uint8_t* mask, size_t n, uint32_t color) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c = _mm_set1_epi32((int)(color & 0x00FFFFFFUL));
+    __m128i m;
+    uint32_t m4;
+    
+    for (; n >= 4; n -= 4, dst += 4, mask += 4) {
+        memcpy(&m4, mask, sizeof(m4));
+        if (m4 == 0) {                              /* Nothing to draw */
+            continue;
+        }
+        m = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)m4), zero), zero);
+        m = _mm_or_si128(_mm_slli_epi32(m, 24), c); /* Coverage to alpha channel */
+        _mm_storeu_si128((__m128i *)dst, over_sse2(m, _mm_loadu_si128((const __m128i *)dst)));
+    }
+    mask32_scalar(dst, mask, n, color);
+}
+
+static void
+image32_sse2(uint32_t* dst, const uint8_t* src, size_t n) {
+    __m128i s;
+    
+    for (; n >= 4; n -= 4, dst += 4, src += 16) {
+        s = image32_to_color_sse2(_mm_loadu_si128((const __m128i *)src));
+        _mm_storeu_si128((__m128i *)dst, over_sse2(s, _mm_loadu_si128((const __m128i *)dst)));
+    }
+    image32_scalar(dst, src, n);
+}
+
+static void
+image32p_sse2(uint32_t* dst, const uint8_t* src, size_t n) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i amask = _mm_set1_epi32((int)0xFF000000UL);
+    __m128i p, d, dl, dh, il, ih;
+    int m;
+    
+    for (; n >= 4; n -= 4, dst += 4, src += 16) {
+        p = _mm_loadu_si128((const __m128i *)src);
+        m = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(p, amask), amask));
+        if (m == 0xFFFF) {                          /* All pixels fully transparent */
+            continue;
+        }
+        m = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(p, amask), zero));
+        if (m == 0xFFFF) {                          /* All pixels fully opaque */
+            _mm_storeu_si128((__m128i *)dst, image32_to_color_sse2(p));
+            continue;
+        }
+        d = _mm_loadu_si128((const __m128i *)dst);
+        il = _mm_unpacklo_epi8(p, zero);            /* Broadcast inverted alpha to all channels */
+        ih = _mm_unpackhi_epi8(p, zero);
+        il = _mm_shufflehi_epi16(_mm_shufflelo_epi16(il, 0xFF), 0xFF);
+        ih = _mm_shufflehi_epi16(_mm_shufflelo_epi16(ih, 0xFF), 0xFF);
+        dl = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), il), c128);
+        dh = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ih), c128);
+        dl = _mm_srli_epi16(_mm_add_epi16(dl, _mm_srli_epi16(dl, 8)), 8);
+        dh = _mm_srli_epi16(_mm_add_epi16(dh, _mm_srli_epi16(dh, 8)), 8);
+        d = _mm_adds_epu8(image32_to_color_sse2(p), _mm_packus_epi16(dl, dh));
+        _mm_storeu_si128((__m128i *)dst, d);
+    }
+    image32p_scalar(dst, src, n);
+}
+#endif /* LL_SOFT_SSE2 || __DOXYGEN__ */
+
+#if LL_SOFT_AVX2 || __DOXYGEN__
+/*******************************************/
+/**              AVX2 kernels             **/
+/*******************************************/
+
+/**
+ * \brief           Blend 8 source pixels over 8 destination pixels
+ * \param[in]       s: Source pixels with coverage in alpha channel
+ * \param[in]       d: Destination pixels
+ * \return          Blended pixels
+ */
+static LL_SOFT_AVX2_FN __m256i
+over_avx2(__m256i s, __m256i d) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i c255 = _mm256_set1_epi16(255);
+    const __m256i c128 = _mm256_set1_epi16(128);
+    const __m256i opaque = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    __m256i sl, sh, dl, dh, al, ah;
+    
+    sl = _mm256_unpacklo_epi8(s, zero);
+    sh = _mm256_unpackhi_epi8(s, zero);
+    dl = _mm256_unpacklo_epi8(d, zero);
+    dh = _mm256_unpackhi_epi8(d, zero);
+    al = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(sl, 0xFF), 0xFF);
+    ah = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(sh, 0xFF), 0xFF);
+    sl = _mm256_or_si256(sl, opaque);
+    sh = _mm256_or_si256(sh, opaque);
+    
+    sl = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(sl, al), _mm256_mullo_epi16(dl, _mm256_sub_epi16(c255, al))), c128);
+    sh = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(sh, ah), _mm256_mullo_epi16(dh, _mm256_sub_epi16(c255, ah))), c128);
+    sl = _mm256_srli_epi16(_mm256_add_epi16(sl, _mm256_srli_epi16(sl, 8)), 8);
+    sh = _mm256_srli_epi16(_mm256_add_epi16(sh, _mm256_srli_epi16(sh, 8)), 8);
+    return _mm256_packus_epi16(sl, sh);             /* Unpack and pack work per 128-bit lane, order is kept */
+}
+
+static LL_SOFT_AVX2_FN void
+fill32_avx2(uint32_t* dst, size_t n, uint32_t color) {
+    const __m256i c = _mm256_set1_epi32((int)color);
+    
+    for (; n >= 8; n -= 8, dst += 8) {
+        _mm256_storeu_si256((__m256i *)dst, c);
+    }
+    fill32_scalar(dst, n, color);
+}
+
+static LL_SOFT_AVX2_FN void
+fill16_avx2(uint16_t* dst, size_t n, uint16_t color) {
+    const __m256i c = _mm256_set1_epi16((short)color);
+    
+    for (; n >= 16; n -= 16, dst += 16) {
+        _mm256_storeu_si256((__m256i *)dst, c);
+    }
+    fill16_scalar(dst, n, color);
+}
+
+static LL_SOFT_AVX2_FN void
+blend32_avx2(uint32_t* dst, const uint32_t* src, size_t n, uint8_t a) {
+    const __m256i alpha = _mm256_set1_epi32((int)((uint32_t)a << 24));
+    const __m256i rgb = _mm256_set1_epi32(0x00FFFFFF);
+    __m256i s;
+    
+    for (; n >= 8; n -= 8, dst += 8, src += 8) {
+        s = _mm256_or_si256(_mm256_and_si256(_mm256_loadu_si256((const __m256i *)src), rgb), alpha);
+        _mm256_storeu_si256((__m256i *)dst, over_avx2(s, _mm256_loadu_si256((const __m256i *)dst)));
+    }
+    blend32_scalar(dst, src, n, a);
+}
+
+static LL_SOFT_AVX2_FN void
+mask32_avx2(uint32_t* dst, const uint8_t* mask, size_t n, uint32_t color) {
+    const __m256i c = _mm256_set1_epi32((int)(color & 0x00FFFFFFUL));
+    __m256i m;
+    uint64_t m8;
+    
+    for (; n >= 8; n -= 8, dst += 8, mask += 8) {
+        memcpy(&m8, mask, sizeof(m8));
+        if (m8 == 0) {                              /* Nothing to draw */
+            continue;
+        }
+        m = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+        m = _mm256_or_si256(_mm256_slli_epi32(m, 24), c);   /* Coverage to alpha channel */
+        _mm256_storeu_si256((__m256i *)dst, over_avx2(m, _mm256_loadu_si256((const __m256i *)dst)));
+    }
+    mask32_scalar(dst, mask, n, color);
+}
+
+static LL_SOFT_AVX2_FN void
+image32_avx2(uint32_t* dst, const uint8_t* src, size_t n) {
+    __m256i p, s;
+    
+    for (; n >= 8; n -= 8, dst += 8, src += 32) {
+        p = _mm256_loadu_si256((const __m256i *)src);
+        s = _mm256_and_si256(p, _mm256_set1_epi32(0x0000FF00)); /* Green stays */
+        s = _mm256_or_si256(s, _mm256_and_si256(_mm256_srli_epi32(p, 16), _mm256_set1_epi32(0x000000FF)));
+        s = _mm256_or_si256(s, _mm256_slli_epi32(_mm256_and_si256(p, _mm256_set1_epi32(0x000000FF)), 16));
+        s = _mm256_or_si256(s, _mm256_andnot_si256(p, _mm256_set1_epi32((int)0xFF000000UL)));
+        _mm256_storeu_si256((__m256i *)dst, over_avx2(s, _mm256_loadu_si256((const __m256i *)dst)));
+    }
+    image32_scalar(dst, src, n);
+}
+
+static LL_SOFT_AVX2_FN void
+image32p_avx2(uint32_t* dst, const uint8_t* src, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i c128 = _mm256_set1_epi16(128);
+    const __m256i amask = _mm256_set1_epi32((int)0xFF000000UL);
+    __m256i p, s, d, dl, dh, il, ih;
+    
+    for (; n >= 8; n -= 8, dst += 8, src += 32) {
+        p = _mm256_loadu_si256((const __m256i *)src);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(p, amask), amask)) == -1) {
+            continue;                               /* All pixels fully transparent */
+        }
+        s = _mm256_and_si256(p, _mm256_set1_epi32(0x0000FF00));
+        s = _mm256_or_si256(s, _mm256_and_si256(_mm256_srli_epi32(p, 16), _mm256_set1_epi32(0x000000FF)));
+        s = _mm256_or_si256(s, _mm256_slli_epi32(_mm256_and_si256(p, _mm256_set1_epi32(0x000000FF)), 16));
+        s = _mm256_or_si256(s, _mm256_andnot_si256(p, amask));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(p, amask), zero)) == -1) {
+            _mm256_storeu_si256((__m256i *)dst, s); /* All pixels fully opaque */
+            continue;
+        }
+        d = _mm256_loadu_si256((const __m256i *)dst);
+        il = _mm256_unpacklo_epi8(p, zero);
+        ih = _mm256_unpackhi_epi8(p, zero);
+        il = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(il, 0xFF), 0xFF);
+        ih = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(ih, 0xFF), 0xFF);
+        dl = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), il), c128);
+        dh = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), ih), c128);
+        dl = _mm256_srli_epi16(_mm256_add_epi16(dl, _mm256_srli_epi16(dl, 8)), 8);
+        dh = _mm256_srli_epi16(_mm256_add_epi16(dh, _mm256_srli_epi16(dh, 8)), 8);
+        _mm256_storeu_si256((__m256i *)dst, _mm256_adds_epu8(s, _mm256_packus_epi16(dl, dh)));
+    }
+    image32p_scalar(dst, src, n);
+}
+#endif /* LL_SOFT_AVX2 || __DOXYGEN__ */
+
+#if LL_SOFT_NEON || __DOXYGEN__
+/*******************************************/
+/**              NEON kernels             **/
+/*******************************************/
+
+/**
+ * \brief           Blend 8 values of single color channel
+ * \param[in]       s: Source channel values
+ * \param[in]       d: Destination channel values
+ * \param[in]       a: Source coverage
+ * \param[in]       ia: Inverted source coverage
+ * \return          Blended channel values
+ */
+static uint8x8_t
+lerp_neon(uint8x8_t s, uint8x8_t d, uint8x8_t a, uint8x8_t ia) {
+    uint16x8_t t = vmlal_u8(vmull_u8(s, a), d, ia);
+    return vraddhn_u16(t, vrshrq_n_u16(t, 8));      /* Same rounding as DIV255 */
+}
+
+/**
+ * \brief           Blend 8 pixels of separated color channels over destination memory
+ * \param[in]       dst: Destination memory of 8 ARGB8888 pixels
+ * \param[in]       r: Red channel of source
+ * \param[in]       g: Green channel of source
+ * \param[in]       b: Blue channel of source
+ * \param[in]       a: Source coverage
+ */
+static void
+over_neon(uint32_t* dst, uint8x8_t r, uint8x8_t g, uint8x8_t b, uint8x8_t a) {
+    uint8x8x4_t d = vld4_u8((const uint8_t *)dst); /* B, G, R, A planes */
+    uint8x8_t ia = vmvn_u8(a);
+    
+    d.val[0] = lerp_neon(b, d.val[0], a, ia);
+    d.val[1] = lerp_neon(g, d.val[1], a, ia);
+    d.val[2] = lerp_neon(r, d.val[2], a, ia);
+    d.val[3] = lerp_neon(vdup_n_u8(0xFF), d.val[3], a, ia);
+    vst4_u8((uint8_t *)dst, d);
+}
+
+static void
+fill32_neon(uint32_t* dst, size_t n, uint32_t color) {
+    const uint32x4_t c = vdupq_n_u32(color);
+    
+    for (; n >= 4; n -= 4, dst += 4) {
+        vst1q_u32(dst, c);
+    }
+    fill32_scalar(dst, n, color);
+}
+
+static void
+fill16_neon(uint16_t* dst, size_t n, uint16_t color) {
+    const uint16x8_t c = vdupq_n_u16(color);
+    
+    for (; n >= 8; n -= 8, dst += 8) {
+        vst1q_u16(dst, c);
+    }
+    fill16_scalar(dst, n, color);
+}
+
+static void
+blend32_neon(uint32_t* dst, const uint32_t* src, size_t n, uint8_t a) {
+    const uint8x8_t alpha = vdup_n_u8(a);
+    uint8x8x4_t s;
+    
+    for (; n >= 8; n -= 8, dst += 8, src += 8) {
+        s = vld4_u8((const uint8_t *)src);
+        over_neon(dst, s.val[2], s.val[1], s.val[0], alpha);
+    }
+    blend32_scalar(dst, src, n, a);
+}
+
+static void
+mask32_neon(uint32_t* dst, const uint8_t* mask, size_t n, uint32_t color) {
+    const uint8x8_t r = vdup_n_u8((uint8_t)(color >> 16));
+    const uint8x8_t g = vdup_n_u8((uint8_t)(color >> 8));
+    const uint8x8_t b = vdup_n_u8((uint8_t)color);
+    
+    for (; n >= 8; n -= 8, dst += 8, mask += 8) {
+        over_neon(dst, r, g, b, vld1_u8(mask));
+    }
+    mask32_scalar(dst, mask, n, color);
+}
+
+static void
+image32_neon(uint32_t* dst, const uint8_t* src, size_t n) {
+    uint8x8x4_t s;
+    
+    for (; n >= 8; n -= 8, dst += 8, src += 32) {
+        s = vld4_u8(src);                           /* R, G, B, inverted A planes */
+        over_neon(dst, s.val[0], s.val[1], s.val[2], vmvn_u8(s.val[3]));
+    }
+    image32_scalar(dst, src, n);
+}
+
+static void
+image32p_neon(uint32_t* dst, const uint8_t* src, size_t n) {
+    const uint8x8_t zero = vdup_n_u8(0);
+    uint8x8x4_t s, d;
+    uint64_t ia;
+    
+    for (; n >= 8; n -= 8, dst += 8, src += 32) {
+        s = vld4_u8(src);                           /* R, G, B, inverted A planes */
+        ia = vget_lane_u64(vreinterpret_u64_u8(s.val[3]), 0);
+        if (ia == ~(uint64_t)0) {                   /* All pixels fully transparent */
+            continue;
+        }
+        if (ia == 0) {                              /* All pixels fully opaque */
+            d.val[0] = s.val[2];
+            d.val[1] = s.val[1];
+            d.val[2] = s.val[0];
+            d.val[3] = vdup_n_u8(0xFF);
+        } else {
+            d = vld4_u8((const uint8_t *)dst);      /* B, G, R, A planes, source is added to scaled destination */
+            d.val[0] = vqadd_u8(s.val[2], lerp_neon(zero, d.val[0], zero, s.val[3]));
+            d.val[1] = vqadd_u8(s.val[1], lerp_neon(zero, d.val[1], zero, s.val[3]));
+            d.val[2] = vqadd_u8(s.val[0], lerp_neon(zero, d.val[2], zero, s.val[3]));
+            d.val[3] = vqadd_u8(vmvn_u8(s.val[3]), lerp_neon(zero, d.val[3], zero, s.val[3]));
+        }
+        vst4_u8((uint8_t *)dst, d);
+    }
+    image32p_scalar(dst, src, n);
+}
+#endif /* LL_SOFT_NEON || __DOXYGEN__ */
+
+/*******************************************/
+/**        Low-level drawing functions    **/
+/*******************************************/
+
+static uint8_t
+LCD_Ready(gui_lcd_t* LCD) {
+    return 1;                                       /* Drawing is always finished on return */
+}
+
+static void
+LCD_SetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    uintptr_t addr = layer->start_address + LCD->pixel_size * (layer->width * y + x);
+    
+    if (LCD->pixel_size == 4) {
+        *(uint32_t *)addr = color;
+    } else {
+        *(uint16_t *)addr = color_to_565(color);
+    }
+}
+
+static gui_color_t
+LCD_GetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
+    uintptr_t addr = layer->start_address + LCD->pixel_size * (layer->width * y + x);
+    
+    if (LCD->pixel_size == 4) {
+        return *(uint32_t *)addr;
+    }
+    return color_from_565(*(uint16_t *)addr);
+}
+
+static void
+LCD_Fill(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t OffLine, gui_color_t color) {
+    if (LCD->pixel_size == 4) {
+        uint32_t* d = dst;
+        for (; ySize > 0; ySize--, d += xSize + OffLine) {
+            kernels.Fill32(d, xSize, color);
+        }
+    } else {
+        uint16_t* d = dst;
+        uint16_t c = color_to_565(color);
+        for (; ySize > 0; ySize--, d += xSize + OffLine) {
+            kernels.Fill16(d, xSize, c);
+        }
+    }
+}
+
+static void
+LCD_Copy(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    const uint8_t* s = src;
+    uint8_t* d = dst;
+    
+    for (; ySize > 0; ySize--) {
+        memcpy(d, s, xSize * LCD->pixel_size);      /* Copy single line */
+        s += (xSize + offLineSrc) * LCD->pixel_size;
+        d += (xSize + offLineDst) * LCD->pixel_size;
+    }
+}
+
+static void
+LCD_CopyBlend(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, uint8_t alphaSrc, uint8_t alphaDst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    gui_dim_t x;
+    
+    if (LCD->pixel_size == 4) {
+        const uint32_t* s = src;
+        uint32_t* d = dst;
+        for (; ySize > 0; ySize--, s += xSize + offLineSrc, d += xSize + offLineDst) {
+            kernels.Blend32(d, s, xSize, alphaSrc);
+        }
+    } else {
+        const uint16_t* s = src;
+        uint16_t* d = dst;
+        for (; ySize > 0; ySize--, s += offLineSrc, d += offLineDst) {
+            for (x = 0; x < xSize; x++, s++, d++) {
+                *d = color_to_565(blend_pixel32(color_from_565(*d), color_from_565(*s), alphaSrc));
+            }
+        }
+    }
+}
+
+static void
+LCD_CopyChar(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst, gui_color_t color) {
+    const uint8_t* m = src;
+    gui_dim_t x;
+    
+    if (LCD->pixel_size == 4) {
+        uint32_t* d = dst;
+        for (; ySize > 0; ySize--, m += xSize + offLineSrc, d += xSize + offLineDst) {
+            kernels.Mask32(d, m, xSize, color);
+        }
+    } else {
+        uint16_t* d = dst;
+        uint16_t c = color_to_565(color);
+        for (; ySize > 0; ySize--, m += offLineSrc, d += offLineDst) {
+            for (x = 0; x < xSize; x++, m++, d++) {
+                if (*m == 0xFF) {
+                    *d = c;
+                } else if (*m) {
+                    *d = color_to_565(blend_pixel32(color_from_565(*d), color, *m));
+                }
+            }
+        }
+    }
+}
+
+static void
+LCD_CopyCharA4(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst, gui_color_t color) {
+    const uint8_t* s = src;
+    uint8_t* d = dst;
+    uint8_t line[64];                               /* Part of line expanded to 8-bit alpha */
+    gui_dim_t x, i, w;
+    
+    for (; ySize > 0; ySize--, s += (xSize + offLineSrc) >> 1, d += (xSize + offLineDst) * LCD->pixel_size) {
+        for (x = 0; x < xSize; x += w) {
+            w = GUI_MIN(xSize - x, (gui_dim_t)sizeof(line));
+            for (i = 0; i < w; i++) {
+                line[i] = (uint8_t)((((x + i) & 0x01) ? (s[(x + i) >> 1] >> 4) : (s[(x + i) >> 1] & 0x0F)) * 0x11);
+            }
+            LCD_CopyChar(LCD, layer, line, d + x * LCD->pixel_size, w, 1, 0, 0, color);
+        }
+    }
+}
+
+static void
+LCD_DrawImage16(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    const uint16_t* s = src;
+    uint8_t* d = dst;
+    uint16_t v;
+    gui_dim_t x;
+    
+    for (; ySize > 0; ySize--, s += offLineSrc, d += offLineDst * LCD->pixel_size) {
+        for (x = 0; x < xSize; x++, s++, d += LCD->pixel_size) {
+            v = (uint16_t)((*s & 0x07E0) | (*s >> 11) | (*s << 11));    /* Swap red and blue */
+            if (LCD->pixel_size == 4) {
+                *(uint32_t *)d = color_from_565(v);
+            } else {
+                *(uint16_t *)d = v;
+            }
+        }
+    }
+}
+
+static void
+LCD_DrawImage24(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    const uint8_t* s = src;
+    uint8_t* d = dst;
+    uint32_t c;
+    gui_dim_t x;
+    
+    for (; ySize > 0; ySize--, s += offLineSrc * 3, d += offLineDst * LCD->pixel_size) {
+        for (x = 0; x < xSize; x++, s += 3, d += LCD->pixel_size) {
+            c = 0xFF000000UL | (uint32_t)s[0] << 16 | (uint32_t)s[1] << 8 | s[2];
+            if (LCD->pixel_size == 4) {
+                *(uint32_t *)d = c;
+            } else {
+                *(uint16_t *)d = color_to_565(c);
+            }
+        }
+    }
+}
+
+static void
+LCD_DrawImage32(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    const uint8_t* s = src;
+    gui_dim_t x;
+    uint32_t c;
+    
+    uint8_t premul = !!(img->flags & GUI_IMAGE_FLAG_PREMULTIPLIED);
+    
+    if (LCD->pixel_size == 4) {
+        uint32_t* d = dst;
+        for (; ySize > 0; ySize--, s += (xSize + offLineSrc) * 4, d += xSize + offLineDst) {
+            if (premul) {
+                kernels.Image32P(d, s, xSize);
+            } else {
+                kernels.Image32(d, s, xSize);
+            }
+        }
+    } else {
+        uint16_t* d = dst;
+        for (; ySize > 0; ySize--, s += offLineSrc * 4, d += offLineDst) {
+            for (x = 0; x < xSize; x++, s += 4, d++) {
+                c = image32_to_color(s);
+                if (!premul) {
+                    *d = color_to_565(blend_pixel32(color_from_565(*d), c, c >> 24));
+                } else if (s[3] != 0xFF) {          /* Skip fully transparent pixel */
+                    *d = color_to_565(blend_premul32(color_from_565(*d), c, s[3]));
+                }
+            }
+        }
+    }
+}
+
+static void
+LCD_DrawImageIndexed(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    const uint8_t* s = src;
+    uint8_t* d = dst;
+    uint32_t c, a;
+    gui_dim_t x;
+    uint8_t i;
+    
+    if (img->palette == NULL) {                     /* Palette is required for indexed image */
+        return;
+    }
+    for (; ySize > 0; ySize--, d += offLineDst * LCD->pixel_size) {
+        for (x = 0; x < xSize; x++, d += LCD->pixel_size) {
+            if (img->bpp == 8) {                    /* Get palette index */
+                i = s[x];
+            } else {
+                i = (x & 0x01) ? (s[x >> 1] >> 4) : (s[x >> 1] & 0x0F);
+            }
+            if (i >= img->palette_size || !(a = img->palette[i] >> 24)) {
+                continue;
+            }
+            c = img->palette[i];
+            if (LCD->pixel_size == 4) {
+                *(uint32_t *)d = a == 0xFF ? c : blend_pixel32(*(uint32_t *)d, c, a);
+            } else {
+                *(uint16_t *)d = color_to_565(a == 0xFF ? c : blend_pixel32(color_from_565(*(uint16_t *)d), c, a));
+            }
+        }
+        s += img->bpp == 8 ? (xSize + offLineSrc) : ((xSize + offLineSrc) >> 1);
+    }
+}
+
+static void
+LCD_FillRect(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t xSize, gui_dim_t ySize, gui_color_t color) {
+    uintptr_t addr = layer->start_address + (LCD->pixel_size * (layer->width * y + x));
+    
+    LCD_Fill(LCD, layer, (void *)addr, xSize, ySize, layer->width - xSize, color);
+}
+
+static void
+LCD_FillRects(gui_lcd_t* LCD, gui_layer_t* layer, const gui_ll_rect_t* rects, size_t count, gui_color_t color) {
+    for (; count > 0; count--, rects++) {
+        LCD_FillRect(LCD, layer, rects->x, rects->y, rects->width, rects->height, color);
+    }
+}
+
+static void
+LCD_CopyChars(gui_lcd_t* LCD, gui_layer_t* layer, const gui_ll_char_t* chars, size_t count, gui_color_t color) {
+    for (; count > 0; count--, chars++) {
+        LCD_CopyChar(LCD, layer, chars->src, chars->dst, chars->width, chars->height, chars->offlinesrc, chars->offlinedst, color);
+    }
+}
+
+static void
+LCD_DrawHLine(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    LCD_FillRect(LCD, layer, x, y, length, 1, color);
+}
+
+static void
+LCD_DrawVLine(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    LCD_FillRect(LCD, layer, x, y, 1, length, color);
+}
+
+#if GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__
+static void
+LCD_Flush(gui_lcd_t* LCD, gui_layer_t* layer) {
+    const uint8_t* s = (const uint8_t *)layer->start_address;
+    uint8_t* d;
+    gui_dim_t y;
+    
+    if (screen == NULL) {                           /* Nowhere to send band */
+        return;
+    }
+    d = screen + LCD->pixel_size * (LCD->width * layer->y_offset + layer->x_offset);
+    for (y = 0; y < layer->height; y++) {           /* Band lines are packed in buffer, screen lines are not */
+        memcpy(d, s, layer->width * LCD->pixel_size);
+        s += layer->width * LCD->pixel_size;
+        d += LCD->width * LCD->pixel_size;
+    }
+}
+
+/**
+ * \brief           Set screen frame buffer for partial buffer mode
+ *
+ *                  Bands drawn to partial buffer are copied to screen frame buffer by \ref gui_ll_t.Flush function.
+ *                  Screen has the same pixel format as layer and is \ref gui_lcd_t.width pixels wide.
+ *                  Useful when screen memory is slow for drawing or not accessible for reading.
+ *
+ * \param[in]       addr: Address of screen frame buffer
+ */
+void
+gui_ll_soft_setscreen(void* addr) {
+    screen = addr;
+}
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER || __DOXYGEN__ */
+
+/**
+ * \brief           Set software drawing functions to low-level structure
+ *
+ *                  Function selects fastest available kernels and sets all drawing functions.
+ *                  Init function and layers setup must still be provided by port.
+ *
+ * \param[in,out]   LL: Pointer to \ref gui_ll_t structure with drawing functions
+ */
+void
+gui_ll_soft_init(gui_ll_t* LL) {
+    static const ll_soft_kernels_t k_scalar = {"scalar", fill32_scalar, fill16_scalar, blend32_scalar, mask32_scalar, image32_scalar, image32p_scalar};
+#if LL_SOFT_SSE2
+    static const ll_soft_kernels_t k_sse2 = {"sse2", fill32_sse2, fill16_sse2, blend32_sse2, mask32_sse2, image32_sse2, image32p_sse2};
+#endif /* LL_SOFT_SSE2 */
+#if LL_SOFT_AVX2
+    static const ll_soft_kernels_t k_avx2 = {"avx2", fill32_avx2, fill16_avx2, blend32_avx2, mask32_avx2, image32_avx2, image32p_avx2};
+#endif /* LL_SOFT_AVX2 */
+#if LL_SOFT_NEON
+    static const ll_soft_kernels_t k_neon = {"neon", fill32_neon, fill16_neon, blend32_neon, mask32_neon, image32_neon, image32p_neon};
+#endif /* LL_SOFT_NEON */
+    
+    kernels = k_scalar;                             /* Scalar kernels are always available */
+#if LL_SOFT_SSE2
+    kernels = k_sse2;
+#endif /* LL_SOFT_SSE2 */
+#if LL_SOFT_AVX2
+#if LL_SOFT_AVX2_RUNTIME
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {           /* Check CPU at run time */
+        kernels = k_avx2;
+    }
+#else
+    kernels = k_avx2;
+#endif /* LL_SOFT_AVX2_RUNTIME */
+#endif /* LL_SOFT_AVX2 */
+#if LL_SOFT_NEON
+    kernels = k_neon;
+#endif /* LL_SOFT_NEON */
+    
+    LL->IsReady = LCD_Ready;
+    LL->SetPixel = LCD_SetPixel;
+    LL->GetPixel = LCD_GetPixel;
+    LL->Fill = LCD_Fill;
+    LL->Copy = LCD_Copy;
+    LL->CopyBlend = LCD_CopyBlend;
+    LL->FillRect = LCD_FillRect;
+    LL->DrawHLine = LCD_DrawHLine;
+    LL->DrawVLine = LCD_DrawVLine;
+    LL->CopyChar = LCD_CopyChar;
+    LL->FillRects = LCD_FillRects;
+    LL->CopyChars = LCD_CopyChars;
+    LL->CopyCharA4 = LCD_CopyCharA4;
+    LL->DrawImage16 = LCD_DrawImage16;
+    LL->DrawImage24 = LCD_DrawImage24;
+    LL->DrawImage32 = LCD_DrawImage32;
+    LL->DrawImageIndexed = LCD_DrawImageIndexed;
+#if GUI_CFG_USE_PARTIAL_BUFFER
+    LL->Flush = LCD_Flush;
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
+}
+
+/**
+ * \brief           Get name of kernel set selected by \ref gui_ll_soft_init
+ * \return          Kernel set name: `scalar`, `sse2`, `avx2` or `neon`
+ */
+const char *
+gui_ll_soft_getkernelname(void) {
+    return kernels.name;
+}
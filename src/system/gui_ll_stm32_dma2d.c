@@ -38,11 +38,152 @@ gui_layer_t Layers[GUI_LAYERS];
 static DMA2D_HandleTypeDef DMA2DHandle;
 uint16_t startAddress;
 
-#define DMA2D_START(type) do {                  \
-    DMA2D->CR = (type);                         \
-    DMA2D->CR |= 0 | 0;             \
-    DMA2D->CR |= DMA2D_CR_START;                /* Start the transmission */\
-} while (0)
+/**
+ * \brief           Number of DMA2D operations which can wait in queue
+ */
+#define DMA2D_QUEUE_SIZE            32
+
+/**
+ * \brief           DMA2D registers common to many transfers
+ *
+ *                  Hardware keeps register values between transfers,
+ *                  they are programmed only when setup of queued transfer differs from previous one
+ */
+typedef struct {
+    uint32_t mode;                          /*!< DMA2D mode, value for CR register */
+    uint32_t fgpfccr;                       /*!< Foreground pixel format and alpha */
+    uint32_t bgpfccr;                       /*!< Background pixel format and alpha */
+    uint32_t opfccr;                        /*!< Output pixel format */
+    uint32_t fgcolr;                        /*!< Foreground color for A8/A4 inputs */
+    uint32_t ocolr;                         /*!< Output color for register to memory mode */
+    uint32_t fgcmar;                        /*!< Foreground CLUT memory address, loaded when `START` bit is set in foreground PFC */
+} dma2d_setup_t;
+
+/**
+ * \brief           Single DMA2D transfer with values for registers different for each transfer
+ */
+typedef struct {
+    uint32_t fgmar;                         /*!< Foreground memory address */
+    uint32_t bgmar;                         /*!< Background memory address */
+    uint32_t omar;                          /*!< Output memory address */
+    uint32_t fgor;                          /*!< Foreground line offset */
+    uint32_t bgor;                          /*!< Background line offset */
+    uint32_t oor;                           /*!< Output line offset */
+    uint32_t nlr;                           /*!< Number of pixels per line and number of lines */
+    const dma2d_setup_t* setup;             /*!< Common registers to program before transfer or `NULL` when unchanged */
+} dma2d_op_t;
+
+static dma2d_op_t queue[DMA2D_QUEUE_SIZE];  /* Ring of waiting operations */
+static dma2d_setup_t setups[DMA2D_QUEUE_SIZE];  /* Common registers, entry is used by operation on the same index */
+static volatile size_t queue_r, queue_w;    /* Read and write index of ring */
+static volatile uint8_t dma2d_busy;         /* Set to 1 when DMA2D processes operation */
+static uint32_t dma2d_cr;                   /* Value for CR register of current setup */
+static dma2d_setup_t setup_next;            /* Setup for next submitted operations */
+static uint8_t setup_changed = 1;           /* Set to 1 when setup_next must be queued with next operation */
+static uint8_t clut_loaded;                 /* Set to 1 when CLUT for operation on read index is loaded */
+static const gui_color_t* clut_addr;        /* Palette loaded to foreground CLUT by last queued operation */
+static uint16_t clut_size;                  /* Number of colors in loaded palette */
+static uint8_t clut_gen;                    /* Generation of loaded palette */
+
+/**
+ * \brief           Start next operation from queue if available
+ * \note            Must be called from DMA2D interrupt or with DMA2D interrupt disabled
+ */
+static void
+dma2d_start_next(void) {
+    const dma2d_op_t* op;
+    const dma2d_setup_t* setup;
+    
+    if (queue_r == queue_w) {                       /* Nothing more to do */
+        dma2d_busy = 0;
+        return;
+    }
+    op = &queue[queue_r];
+    
+    if ((setup = op->setup) != NULL) {              /* Program common registers only when changed */
+        if ((setup->fgpfccr & DMA2D_FGPFCCR_START) && !clut_loaded) {
+            /*
+             * Load foreground CLUT first and start operation
+             * from CLUT transfer complete interrupt
+             */
+            dma2d_busy = 1;
+            clut_loaded = 1;
+            DMA2D->FGCMAR = setup->fgcmar;
+            DMA2D->CR = DMA2D_CR_CTCIE | DMA2D_CR_TEIE;
+            DMA2D->FGPFCCR = setup->fgpfccr;
+            return;
+        }
+        clut_loaded = 0;
+        DMA2D->FGPFCCR = setup->fgpfccr & ~DMA2D_FGPFCCR_START;
+        DMA2D->BGPFCCR = setup->bgpfccr;
+        DMA2D->OPFCCR = setup->opfccr;
+        DMA2D->FGCOLR = setup->fgcolr;
+        DMA2D->OCOLR = setup->ocolr;
+        dma2d_cr = setup->mode | DMA2D_CR_TCIE | DMA2D_CR_TEIE; /* Set mode and enable interrupts */
+    }
+    DMA2D->FGMAR = op->fgmar;
+    DMA2D->BGMAR = op->bgmar;
+    DMA2D->OMAR = op->omar;
+    DMA2D->FGOR = op->fgor;
+    DMA2D->BGOR = op->bgor;
+    DMA2D->OOR = op->oor;
+    DMA2D->NLR = op->nlr;
+    
+    queue_r = (queue_r + 1) % DMA2D_QUEUE_SIZE;     /* Operation is in hardware now */
+    dma2d_busy = 1;
+    DMA2D->CR = dma2d_cr;
+    DMA2D->CR |= DMA2D_CR_START;                    /* Start the transmission */
+}
+
+/**
+ * \brief           Set common registers for next submitted operations
+ * \note            Setup is queued only when it differs from previous one,
+ *                      batch of operations with the same setup programs common registers once
+ * \param[in]       setup: Common registers for next operations
+ */
+static void
+dma2d_setup(const dma2d_setup_t* setup) {
+    if (setup_changed || (setup->fgpfccr & DMA2D_FGPFCCR_START) || memcmp(&setup_next, setup, sizeof(*setup))) {
+        setup_next = *setup;
+        setup_changed = 1;
+    }
+}
+
+/**
+ * \brief           Add new operation to queue and start it if DMA2D is idle
+ * 
+ *                  Function waits only when queue is full
+ * \param[in]       op: Operation to add to queue, setup member is set by function
+ */
+static void
+dma2d_submit(dma2d_op_t* op) {
+    size_t next = (queue_w + 1) % DMA2D_QUEUE_SIZE;
+    
+    while (next == queue_r);                        /* Wait for free entry in queue */
+    op->setup = NULL;
+    if (setup_changed) {                            /* Setup goes to the same index as operation */
+        setups[queue_w] = setup_next;
+        op->setup = &setups[queue_w];
+        setup_changed = 0;
+    }
+    queue[queue_w] = *op;                           /* Copy operation to queue */
+    
+    HAL_NVIC_DisableIRQ(DMA2D_IRQn);                /* Protect against transfer complete interrupt */
+    queue_w = next;
+    if (!dma2d_busy) {                              /* Start immediatelly if DMA2D is idle */
+        dma2d_start_next();
+    }
+    HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+/**
+ * \brief           Wait for all operations in queue to finish
+ * \note            Use before CPU access to memory used by DMA2D
+ */
+static void
+dma2d_wait(void) {
+    while (dma2d_busy || queue_r != queue_w);
+}
 
 static
 void LCD_Init(gui_lcd_t* LCD) {
@@ -64,33 +205,35 @@ uint32_t GetPixelFormat(gui_layer_t* layer) {
 
 static
 uint8_t LCD_Ready(gui_lcd_t* LCD) {
-    return !(DMA2D->CR & DMA2D_CR_START);           /* Return status */
+    return !dma2d_busy && queue_r == queue_w;       /* Return status */
 }
 
 static
 gui_color_t LCD_GetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
 #if defined(LCD_COLOR_FORMAT_ARGB8888)
+    dma2d_wait();                                   /* Pixel may still be written by DMA2D */
     return *(gui_color_t *)(layer->start_address + GUI.lcd.pixel_size * (layer->width * y + x));
 #else
-    gui_color_t color;
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait till end */
-    
-    DMA2D->FGMAR = (uint32_t)(layer->start_address + GUI.lcd.pixel_size * (layer->width * y + x));
-    DMA2D->OMAR = (uint32_t)&color;                 /* Set output address */
-    DMA2D->FGOR = 0;                                /* Set foreground offline */    
-    DMA2D->OOR = 0;                                 /* Set output offline */
-    DMA2D->FGPFCCR = GetPixelFormat(layer);         /* Get source pixel format */
-    DMA2D->OPFCCR = LTDC_PIXEL_FORMAT_ARGB8888;     /* Set output pixel format */
-    DMA2D->NLR = (uint32_t)(1 << 16) | (uint16_t)1; /* Set X and Y */
-
-    DMA2D_START(DMA2D_M2M_PFC);                     /* Start DMA2D transfer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait till end */
+    volatile gui_color_t color;
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
+    
+    setup.mode = DMA2D_M2M_PFC;
+    setup.fgpfccr = GetPixelFormat(layer);          /* Get source pixel format */
+    setup.opfccr = LTDC_PIXEL_FORMAT_ARGB8888;      /* Set output pixel format */
+    op.fgmar = (uint32_t)(layer->start_address + GUI.lcd.pixel_size * (layer->width * y + x));
+    op.omar = (uint32_t)&color;                     /* Set output address */
+    op.nlr = (uint32_t)(1 << 16) | (uint16_t)1;     /* Set X and Y */
+
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
+    dma2d_wait();                                   /* Wait till end */
     return 0xFF000000UL | color;
 #endif /* defined(LCD_COLOR_FORMAT_ARGB8888) */
 }
 
 static
-void LCD_Fill(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t OffLine, gui_color_t color) {
+uint32_t GetOutputColor(gui_color_t color) {
 #if LCD_PIXEL_SIZE == 2
     uint8_t r, g, b;
 //    r = (color >> 20) & 0x0F;
@@ -102,157 +245,263 @@ void LCD_Fill(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, gui_dim_t xSize, gu
     b = (color >>  3) & 0x1F;
     color = 0x00000000UL | (r << 11) | (g << 5) | b;
 #endif
+    return color;
+}
+
+/* Set common registers for filling with color */
+static
+void SetupFill(gui_layer_t* layer, gui_color_t color) {
+    dma2d_setup_t setup = {0};
+    
+    setup.mode = DMA2D_R2M;
+    setup.ocolr = GetOutputColor(color);            /* Color to be used */
+    setup.opfccr = GetPixelFormat(layer);           /* Defines the number of pixels to be transfered */
+    dma2d_setup(&setup);
+}
+
+/* Set common registers for blending alpha only source with color */
+static
+void SetupChar(gui_layer_t* layer, uint32_t input, gui_color_t color) {
+    uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    dma2d_setup_t setup = {0};
+    
+    setup.mode = DMA2D_M2M_BLEND;
+    setup.fgcolr = color & 0x00FFFFFFUL;            /* Since foreground input color is A8/A4, value in this register will be used for blending purpose */
+    setup.fgpfccr = input;                          /* Foreground PFC Control Register */
+    setup.bgpfccr = PixelFormat;                    /* Background PFC Control Register (Defines the BG pixel format) */
+    setup.opfccr = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
+    dma2d_setup(&setup);
+}
+
+/* Set transfer registers for blending source to destination */
+static
+void SetBlendOp(dma2d_op_t* op, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    op->fgmar = (uint32_t)src;
+    op->bgmar = (uint32_t)dst;
+    op->omar = (uint32_t)dst;
+    op->fgor = offLineSrc;
+    op->bgor = offLineDst;
+    op->oor = offLineDst;
+    op->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+}
+
+static
+void LCD_Fill(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t OffLine, gui_color_t color) {
+    dma2d_op_t op = {0};
+    
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->OCOLR = color;                           /* Color to be used */
-    DMA2D->OMAR = (uint32_t)dst;                    /* Destination address */
-    DMA2D->OOR = OffLine;                           /* Destination line offset */
-    DMA2D->OPFCCR = GetPixelFormat(layer);          /* Defines the number of pixels to be transfered */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize; /* Size configuration of area to be transfered */
-    
-    DMA2D_START(DMA2D_R2M);                         /* Start DMA2D transfer */
+    SetupFill(layer, color);
+    op.omar = (uint32_t)dst;                        /* Destination address */
+    op.oor = OffLine;                               /* Destination line offset */
+    op.nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize; /* Size configuration of area to be transfered */
+    
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
 static
 void LCD_Copy(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
     uint32_t PixelFormat = GetPixelFormat(layer);
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
     
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = PixelFormat;
-    DMA2D->BGPFCCR = PixelFormat;
-    DMA2D->OPFCCR = PixelFormat;
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
-    
-    DMA2D_START(DMA2D_M2M);                         /* Start DMA2D transfer */
+    setup.mode = DMA2D_M2M;
+    setup.fgpfccr = PixelFormat;
+    setup.bgpfccr = PixelFormat;
+    setup.opfccr = PixelFormat;
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);
+    
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
 /* Copy layers with blending with alpha combine */
 static
 void LCD_CopyBlending(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, uint8_t alphaSrc, uint8_t alphaDst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = PixelFormat;                   /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
-    
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_AM_0 | alphaSrc << 24;               /* Set alpha for source */
-    DMA2D->BGPFCCR |= alphaDst << 24;               /* Set alpha for destination */
-    
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
-    
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
+    
+    setup.mode = DMA2D_M2M_BLEND;
+    setup.fgpfccr = PixelFormat;                    /* Foreground PFC Control Register */
+    setup.bgpfccr = PixelFormat;                    /* Background PFC Control Register (Defines the BG pixel format) */
+    setup.opfccr = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
+    
+    setup.fgpfccr |= DMA2D_FGPFCCR_AM_0 | alphaSrc << 24;  /* Set alpha for source */
+    setup.bgpfccr |= alphaDst << 24;                /* Set alpha for destination */
+    
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);
+    
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
 static
 void LCD_DrawImage16(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
+    
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = DMA2D_INPUT_RGB565;            /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    setup.mode = DMA2D_M2M_BLEND;
+    setup.fgpfccr = DMA2D_INPUT_RGB565;             /* Foreground PFC Control Register */
+    setup.bgpfccr = PixelFormat;                    /* Background PFC Control Register (Defines the BG pixel format) */
+    setup.opfccr = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
     
     /* Enable invert alpha and swap R and B values with hardware */
 #if defined(DMA2D_FGPFCCR_AI) && defined(DMA2D_FGPFCCR_RBS)
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_RBS;
+    setup.fgpfccr |= DMA2D_FGPFCCR_RBS;
 #endif  /* defined(DMA2D_FGPFCCR_AM_1) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize; 
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);
     
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
 static
 void LCD_DrawImage24(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = DMA2D_INPUT_RGB888;            /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
+    
+    setup.mode = DMA2D_M2M_BLEND;
+    setup.fgpfccr = DMA2D_INPUT_RGB888;             /* Foreground PFC Control Register */
+    setup.bgpfccr = PixelFormat;                    /* Background PFC Control Register (Defines the BG pixel format) */
+    setup.opfccr = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
     
     /* Enable invert alpha and swap R and B values with hardware */
 #if defined(DMA2D_FGPFCCR_RBS)
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_RBS;
+    setup.fgpfccr |= DMA2D_FGPFCCR_RBS;
 #endif  /* defined(DMA2D_FGPFCCR_AM_1) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);
     
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
+/**
+ * \brief           Blend 32BPP image with premultiplied alpha with CPU
+ * \note            DMA2D has no input format with premultiplied alpha,
+ *                      one multiply-add per channel is done only for partially transparent pixels
+ */
+static
+void DrawImage32Premultiplied(gui_lcd_t* LCD, const uint8_t* s, uint8_t* d, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
+    uint32_t c, dc, t, ia, i;
+    gui_dim_t x;
+    
+    dma2d_wait();                                   /* Destination may still be written by DMA2D */
+    for (; ySize > 0; ySize--, s += offLineSrc * 4, d += offLineDst * LCD->pixel_size) {
+        for (x = 0; x < xSize; x++, s += 4, d += LCD->pixel_size) {
+            ia = s[3];                              /* Image has inverted alpha */
+            if (ia == 0xFF) {                       /* Skip fully transparent pixel */
+                continue;
+            }
+            c = (255 - ia) << 24 | (uint32_t)s[0] << 16 | (uint32_t)s[1] << 8 | s[2];
+            if (ia) {                               /* Add destination scaled with inverted alpha */
+#if defined(LCD_COLOR_FORMAT_ARGB8888)
+                dc = *(uint32_t *)d;
+#else
+                dc = *(uint16_t *)d;
+                dc = 0xFF000000UL | ((dc >> 8) & 0xF8) << 16 | ((dc >> 3) & 0xFC) << 8 | ((dc << 3) & 0xF8);
+#endif /* defined(LCD_COLOR_FORMAT_ARGB8888) */
+                for (i = 0; i < 32; i += 8) {
+                    t = ((dc >> i) & 0xFF) * ia + 128;
+                    c += ((t + (t >> 8)) >> 8) << i;
+                }
+            }
+#if defined(LCD_COLOR_FORMAT_ARGB8888)
+            *(uint32_t *)d = c;
+#else
+            *(uint16_t *)d = (uint16_t)GetOutputColor(c);
+#endif /* defined(LCD_COLOR_FORMAT_ARGB8888) */
+        }
+    }
+}
+
+
 static
 void LCD_DrawImage32(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = DMA2D_INPUT_ARGB8888;          /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
+    
+    if (img->flags & GUI_IMAGE_FLAG_PREMULTIPLIED) {
+        DrawImage32Premultiplied(LCD, src, dst, xSize, ySize, offLineSrc, offLineDst);
+        return;
+    }
+    setup.mode = DMA2D_M2M_BLEND;
+    setup.fgpfccr = DMA2D_INPUT_ARGB8888;           /* Foreground PFC Control Register */
+    setup.bgpfccr = PixelFormat;                    /* Background PFC Control Register (Defines the BG pixel format) */
+    setup.opfccr = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
     
     /* Enable invert alpha and swap R and B values with hardware */
 #if defined(DMA2D_FGPFCCR_AI) && defined(DMA2D_FGPFCCR_RBS)
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_AI | DMA2D_FGPFCCR_RBS;
+    setup.fgpfccr |= DMA2D_FGPFCCR_AI | DMA2D_FGPFCCR_RBS;
 #endif  /* defined(DMA2D_FGPFCCR_AM_1) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);
     
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
 static
-void LCD_CopyChar(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst, gui_color_t color) {
+void LCD_DrawImageIndexed(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    dma2d_setup_t setup = {0};
+    dma2d_op_t op = {0};
+    
+    if (!xSize || !ySize || img->palette == NULL || !img->palette_size) {
+        return;
+    }
+    setup.mode = DMA2D_M2M_BLEND;
+    setup.fgpfccr = img->bpp == 4 ? DMA2D_INPUT_L4 : DMA2D_INPUT_L8;    /* Foreground PFC Control Register */
+    setup.fgpfccr |= DMA2D_CCM_ARGB8888 | ((uint32_t)(img->palette_size - 1) << DMA2D_FGPFCCR_CS_Pos);  /* CLUT format and size */
+    setup.bgpfccr = PixelFormat;                    /* Background PFC Control Register (Defines the BG pixel format) */
+    setup.opfccr = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
+    if (clut_addr != img->palette || clut_size != img->palette_size
+        || clut_gen != img->palette_gen) {          /* Load palette only when changed */
+        setup.fgcmar = (uint32_t)img->palette;
+        setup.fgpfccr |= DMA2D_FGPFCCR_START;
+        clut_addr = img->palette;
+        clut_size = img->palette_size;
+        clut_gen = img->palette_gen;
+    }
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);    /* Offset is in units of pixels also for L4 input */
+    
+    dma2d_setup(&setup);
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
+}
+
+static
+void LCD_CopyChar(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst, gui_color_t color) {
+    dma2d_op_t op = {0};
     
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;  
-    DMA2D->FGCOLR = color & 0x00FFFFFFUL;           /* Since foreground input color is A4, value in this register will be used for blending purpose */
-    DMA2D->FGPFCCR = DMA2D_INPUT_A8;                /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize; 
-    
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    SetupChar(layer, DMA2D_INPUT_A8, color);
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);
+    
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
+}
+
+static
+void LCD_CopyCharA4(gui_lcd_t* LCD, gui_layer_t* layer, const void* src, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineSrc, gui_dim_t offLineDst, gui_color_t color) {
+    dma2d_op_t op = {0};
+    
+    if (!xSize || !ySize) {
+        return;
+    }
+    SetupChar(layer, DMA2D_INPUT_A4, color);        /* Font data are read directly from flash */
+    SetBlendOp(&op, src, dst, xSize, ySize, offLineSrc, offLineDst);    /* Offset is in units of pixels also for A4 input */
+    
+    dma2d_submit(&op);                              /* Start DMA2D transfer */
 }
 
 static
@@ -276,19 +525,61 @@ void LCD_FillRect(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y,
     LCD_Fill(LCD, layer, (void *)addr, xSize, ySize, layer->width - xSize, color);
 }
 
+/* Fill list of rectangles, registers common to all rectangles are programmed only once */
+static
+void LCD_FillRects(gui_lcd_t* LCD, gui_layer_t* layer, const gui_ll_rect_t* rects, size_t count, gui_color_t color) {
+    dma2d_op_t op = {0};
+    
+    SetupFill(layer, color);                        /* Queued with first rectangle only */
+    for (; count > 0; count--, rects++) {
+        op.omar = (uint32_t)(layer->start_address + (LCD->pixel_size * (layer->width * rects->y + rects->x)));
+        op.oor = layer->width - rects->width;
+        op.nlr = (uint32_t)(rects->width << 16) | (uint16_t)rects->height;
+        
+        dma2d_submit(&op);                          /* Start DMA2D transfer */
+    }
+}
+
+/* Copy list of characters with the same color, registers common to all characters are programmed only once */
+static
+void LCD_CopyChars(gui_lcd_t* LCD, gui_layer_t* layer, const gui_ll_char_t* chars, size_t count, gui_color_t color) {
+    dma2d_op_t op = {0};
+    
+    SetupChar(layer, DMA2D_INPUT_A8, color);        /* Queued with first character only */
+    for (; count > 0; count--, chars++) {
+        SetBlendOp(&op, chars->src, chars->dst, chars->width, chars->height, chars->offlinesrc, chars->offlinedst);
+        
+        dma2d_submit(&op);                          /* Start DMA2D transfer */
+    }
+}
+
 static
 void LCD_SetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
     LCD_DrawHLine(LCD, layer, x, y, 1, color);
 }
 
+void TransferErrorCallback(DMA2D_HandleTypeDef* hdma2d) {
+     while (1);
+}
+
 /* Process DMA2D interrupt */
 void DMA2D_IRQHandler(void) {
-    HAL_DMA2D_IRQHandler(&DMA2DHandle);
+    uint32_t isr = DMA2D->ISR;
+    
+    if (isr & DMA2D_ISR_TEIF) {                     /* Check transfer error */
+        DMA2D->IFCR = DMA2D_IFCR_CTEIF;
+        TransferErrorCallback(&DMA2DHandle);
+    }
+    if (isr & DMA2D_ISR_CTCIF) {                    /* Check CLUT transfer complete */
+        DMA2D->IFCR = DMA2D_IFCR_CCTCIF;
+        dma2d_start_next();                         /* Start operation which waits for CLUT */
+    }
+    if (isr & DMA2D_ISR_TCIF) {                     /* Check transfer complete */
+        DMA2D->IFCR = DMA2D_IFCR_CTCIF;
+        dma2d_start_next();                         /* Chain next operation from queue */
+    }
 }
 
-void TransferErrorCallback(DMA2D_HandleTypeDef* hdma2d) {
-     while (1);
-}
 uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
     switch (cmd) {
         case GUI_LL_Command_Init: {
@@ -312,7 +603,7 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
                 static uint8_t SDRAMMemory[SDRAM_HEAP_SIZE] __attribute__((at(SDRAM_START_ADR + SDRAM_MEMORY_SIZE - SDRAM_HEAP_SIZE))); /* SDRAM heap memory */
 #endif
                 static GUI_MEM_Region_t const regions[] = {
-                    {DTCMMemory1, sizeof(DTCMMemory1)},
+                    {DTCMMemory1, sizeof(DTCMMemory1), GUI_MEM_REGION_FAST},  /* DTCM is reachable by DMA2D */
                     {SDRAMMemory, sizeof(SDRAMMemory)},
                 };
                 gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
@@ -352,7 +643,11 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             LL->DrawImage16 = LCD_DrawImage16;  /* Set draw function for 24bit image (RGB565) format */
             LL->DrawImage24 = LCD_DrawImage24;  /* Set draw function for 24bit image (RGB888) format */
             LL->DrawImage32 = LCD_DrawImage32;  /* Set draw function for 32bit image (ARGB8888/ABGR8888) format */
+            LL->DrawImageIndexed = LCD_DrawImageIndexed;    /* Set draw function for L8 and L4 images with palette */
             LL->CopyChar = LCD_CopyChar;        /* Set draw function for char copy with alpha information */
+            LL->FillRects = LCD_FillRects;      /* Set fill list of rectangles routine */
+            LL->CopyChars = LCD_CopyChars;      /* Set copy list of chars routine */
+            LL->CopyCharA4 = LCD_CopyCharA4;    /* Set draw function for char copy with 4-bit alpha from font */
             
             if (result) {
                 *(uint8_t *)result = 0;         /* Successful initialization */
@@ -365,6 +660,7 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
         }
         case GUI_LL_Command_SetActiveLayer: {   /* Set new active layer */
             gui_layer_t* layer = (gui_layer_t *)param;/* Read layer as byte */
+            dma2d_wait();                       /* Layer must be fully drawn before it is shown */
             layer->pending = 1;                 /* Set layer as pending and redraw on next reload */
 
             if (result) {
@@ -274,6 +274,21 @@ LCD_FillRect(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_d
     LCD_Fill(LCD, layer, (void *)addr, xSize, ySize, layer->width - xSize, color);
 }
 
+#if GUI_CFG_USE_PARTIAL_BUFFER
+#define LCD_PARTIAL_BUFFER_LINES    40          /* Number of screen lines in partial buffer */
+
+static uint8_t PartialBuffer[LCD_WIDTH * LCD_PIXEL_SIZE * LCD_PARTIAL_BUFFER_LINES];
+
+/* Copy band from partial buffer to its position in LCD frame buffer */
+static void
+LCD_Flush(gui_lcd_t* LCD, gui_layer_t* layer) {
+    uint32_t addr = LCD_FRAME_BUFFER + (LCD->PixelSize * (LCD->width * layer->y_offset + layer->x_offset));
+    
+    LCD_Copy(LCD, layer, (void *)layer->StartAddress, (void *)addr, layer->width, layer->height, 0, LCD->width - layer->width);
+    while (DMA2D->CR & DMA2D_CR_START);             /* Partial buffer is used for next band after return */
+}
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
+
 static void
 LCD_SetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
     LCD_DrawHLine(LCD, layer, x, y, 1, color);
@@ -317,7 +332,7 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
                 static uint8_t SDRAMMemory[SDRAM_HEAP_SIZE] __attribute__((at(SDRAM_START_ADR + SDRAM_MEMORY_SIZE - SDRAM_HEAP_SIZE))); /* SDRAM heap memory */
 #endif
                 static GUI_MEM_Region_t const regions[] = {
-                    {DTCMMemory1, sizeof(DTCMMemory1)},
+                    {DTCMMemory1, sizeof(DTCMMemory1), GUI_MEM_REGION_FAST | GUI_MEM_REGION_NO_DMA},  /* CCM RAM is not reachable by DMA */
                     {SDRAMMemory, sizeof(SDRAMMemory)},
                 };
                 gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
@@ -333,12 +348,20 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
             /*******************************/
             /* Set layers count            */
             /*******************************/
+#if GUI_CFG_USE_PARTIAL_BUFFER
+            LCD->LayersCount = 1;               /* Single layer in partial buffer, bands are copied to LCD frame buffer */
+            LCD->Layers = Layers;
+            Layers[0].Num = 0;
+            Layers[0].StartAddress = (uint32_t)PartialBuffer;
+            LCD->buffer_size = sizeof(PartialBuffer);
+#else
             LCD->LayersCount = GUI_LAYERS;      /* We have 2 layers for our low-level driver */
             LCD->Layers = Layers;
             for (i = 0; i < GUI_LAYERS; i++) {  /* Set each layer */
                 Layers[i].Num = i;
                 Layers[i].StartAddress = LCD_FRAME_BUFFER + (i * LCD_FRAME_BUFFER_SIZE);
             }
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
             
             /*******************************/
             /* Set up LCD drawing routines */
@@ -358,6 +381,9 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
             LL->DrawImage24 = LCD_DrawImage24;  /* Set draw function for 24bit image (RGB888) format */
             LL->DrawImage32 = LCD_DrawImage32;  /* Set draw function for 32bit image (ARGB8888/ABGR8888) format */
             LL->CopyChar = LCD_CopyChar;        /* Set draw function for char copy with alpha information */
+#if GUI_CFG_USE_PARTIAL_BUFFER
+            LL->Flush = LCD_Flush;              /* Set function to send band from partial buffer to LCD */
+#endif /* GUI_CFG_USE_PARTIAL_BUFFER */
             
             if (result != NULL) {
                 *(uint8_t *)result = 0;         /* Successful initialization */
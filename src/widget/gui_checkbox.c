@@ -171,6 +171,7 @@ gui_checkbox_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param,
                 f.align = GUI_HALIGN_LEFT | GUI_VALIGN_CENTER;
                 f.color1width = f.width;
                 f.color1 = guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_TEXT);
+                f.layout = guii_widget_gettextlayout(h);  /* Use cached text layout */
                 gui_draw_writetext(disp, guii_widget_getfont(h), guii_widget_gettext(h), &f);
             }
             
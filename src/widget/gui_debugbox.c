@@ -317,7 +317,7 @@ gui_debugbox_addstring(gui_handle_p h, const gui_char* text) {
     
     __GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);  /* Check input parameters */
     
-    item = GUI_MEMALLOC(sizeof(*item) + gui_string_lengthtotal(text) + 1);  /* Allocate memory for entry */
+    item = GUI_MEMALLOC_CLASS(sizeof(*item) + gui_string_lengthtotal(text) + 1, GUI_MEM_CLASS_BULK);    /* Allocate memory for entry */
     if (item != NULL) {
         __GUI_ENTER();                              /* Enter GUI */
         item->text = (void *)((char *)item + sizeof(*item));/* Add text to entry */
@@ -567,9 +567,9 @@ gui_graph_data_create(gui_id_t id, gui_graph_type_t type, size_t length) {
         data->type = type;
         data->length = length;
         if (type == GUI_GRAPH_TYPE_YT) {            /* Only Y values are stored */
-            data->data = GUI_MEMALLOC(sizeof(*data->data) * length);/* Store Y values for plot */
+            data->data = GUI_MEMALLOC_CLASS(sizeof(*data->data) * length, GUI_MEM_CLASS_BULK);/* Store Y values for plot */
         } else {
-            data->data = GUI_MEMALLOC(sizeof(*data->data) * length * 2);/* Store X and Y values for plot */
+            data->data = GUI_MEMALLOC_CLASS(sizeof(*data->data) * length * 2, GUI_MEM_CLASS_BULK);/* Store X and Y values for plot */
         }
         if (data->data == NULL) {
             GUI_MEMFREE(data);                      /* Remove widget because data memory could not be allocated */
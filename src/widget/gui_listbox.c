@@ -194,6 +194,8 @@ delete_item(gui_handle_p h, uint16_t index) {
     item = get_item(h, index);                      /* Get list item from handle */
     if (item) {
         gui_linkedlist_remove_gen(&__GL(h)->root, &item->list);
+        guii_textlayout_free(&item->layout);        /* Free item text layout */
+        GUI_MEMFREE(item);                          /* Free item memory */
         __GL(h)->count--;                           /* Decrease count */
         
         if (o->selected == index) {
@@ -296,6 +298,7 @@ gui_listbox_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param, g
                     } else {
                         f.color1 = guii_widget_getcolor(h, GUI_LISTBOX_COLOR_TEXT);
                     }
+                    f.layout = guii_textlayout_get(&item->layout);  /* Use cached item text layout */
                     gui_draw_writetext(disp, guii_widget_getfont(h), item->text, &f);
                     f.y += itemheight;
                 }
@@ -307,6 +310,7 @@ gui_listbox_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param, g
         case GUI_WC_Remove: {
             gui_listbox_item_t* item;
             while ((item = (gui_listbox_item_t *)gui_linkedlist_remove_gen(&o->root, (gui_linkedlist_t *)gui_linkedlist_getnext_gen(&o->root, NULL))) != NULL) {
+                guii_textlayout_free(&item->layout);/* Free item text layout */
                 GUI_MEMFREE(item);                  /* Free memory */
             }
             return 1;
@@ -449,6 +453,8 @@ gui_listbox_addstring(gui_handle_p h, const gui_char* text) {
  * \param[in,out]   h: Widget handle
  * \param[in]       index: Index (position) on list to set/change text
  * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory!
+ * \note            When text is modified in place, call this function again with the same pointer
+ *                      to force new text measurement and redraw
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
@@ -461,6 +467,7 @@ gui_listbox_setstring(gui_handle_p h, uint16_t index, const gui_char* text) {
     item = get_item(h, index);                      /* Get list item from handle */
     if (item) {
         item->text = (gui_char *)text;              /* Set new text */
+        guii_textlayout_reset(&item->layout);       /* Text must be measured again */
         guii_widget_invalidate(h);                 /* Invalidate widget */
     }
 
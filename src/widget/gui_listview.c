@@ -203,6 +203,7 @@ remove_row_items(gui_listview_row_t* row) {
     gui_listview_item_t* item;
     
     while ((item = (gui_listview_item_t *)gui_linkedlist_remove_gen(&row->root, (gui_linkedlist_t *)gui_linkedlist_getnext_gen(&row->root, NULL))) != NULL) {
+        guii_textlayout_free(&item->layout);        /* Free item text layout */
         GUI_MEMFREE(item);
     }
 }
@@ -318,6 +319,7 @@ gui_listview_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param,
                         f.width = o->cols[i]->width - 6;    /* Set width */
                         f.x = xTmp + 3;             /* Set offset */
                     }
+                    f.layout = guii_textlayout_get(&o->cols[i]->layout);  /* Use cached header text layout */
                     gui_draw_writetext(disp, guii_widget_getfont(h), o->cols[i]->text, &f);
                     xTmp += o->cols[i]->width;      /* Increase X value */
                 }
@@ -352,6 +354,7 @@ gui_listview_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param,
                                 f.width = o->cols[i]->width - 6;    /* Set width */
                                 f.color1width = GUI.lcd.width;  /* Use the same color for entire width */
                                 f.x = xTmp + 3;     /* Set offset */
+                                f.layout = guii_textlayout_get(&item->layout);  /* Use cached item text layout */
                                 gui_draw_writetext(disp, guii_widget_getfont(h), item->text, &f);
                             }
                             xTmp += o->cols[i]->width;  /* Increase X value */
@@ -375,6 +378,7 @@ gui_listview_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param,
              */
             if (o->cols != NULL) {
                 for (i = 0; i < o->col_count; i++) {
+                    guii_textlayout_free(&o->cols[i]->layout);  /* Free header text layout */
                     GUI_MEMFREE(o->cols[i]);        /* Remove column object */
                 }
                 GUI_MEMFREE(o->cols);               /* Remove block of pointers to columns */
@@ -654,7 +658,9 @@ gui_listview_removerows(gui_handle_p h) {
  * \param[in]       h: Widget handle
  * \param[in]       row: Row object handle, previously returned with \ref gui_listview_addrow function
  * \param[in]       col: Column number to set. First column is on index = 0
- * \param[in]       text: Text to use for item
+ * \param[in]       text: Text to use for item. Only pointer is saved to memory!
+ * \note            When text is modified in place, call this function again with the same pointer
+ *                      to force new text measurement and redraw
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
@@ -681,6 +687,8 @@ gui_listview_setitemstring(gui_handle_p h, gui_listview_row_p row, uint16_t col,
     }
     if (item != NULL) {
         item->text = (gui_char *)text;              /* Set text to item */
+        guii_textlayout_reset(&item->layout);       /* Text must be measured again */
+        guii_widget_invalidate(h);                 /* Invalidate widget */
         ret = 1;
     }
 
@@ -98,6 +98,12 @@ remove_widget(gui_handle_p h) {
      */
     guii_widget_invalidatewithparent(h);            /* Invalidate object and its parent */
     guii_widget_freetextmemory(h);                  /* Free text memory */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+    if (h->textlayout.lines != NULL) {              /* Check text layout memory */
+        GUI_MEMFREE(h->textlayout.lines);           /* Free text layout memory */
+        h->textlayout.lines = NULL;
+    }
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
     if (h->timer != NULL) {                         /* Check timer memory */
         guii_timer_remove(&h->timer);               /* Free timer memory */
     }
@@ -179,6 +185,113 @@ remove_widgets(gui_handle_p parent) {
 #endif /* GUI_CFG_OS */
 }
 
+/**
+ * \brief           Calculate width of widget according to current setup (expanded, fill, percent, etc.)
+ * \param[in]       h: Widget handle
+ * \return          Total width in units of pixels
+ */
+static gui_dim_t
+calculate_widget_width(gui_handle_p h) {
+    if (guii_widget_getflag(h, GUI_FLAG_EXPANDED)) {   /* Maximize window over parent */
+        return guii_widget_getparentinnerwidth(h); /* Return parent inner width */
+    } else if (guii_widget_getflag(h, GUI_FLAG_WIDTH_FILL)) {  /* "fill_parent" mode for width */
+        gui_dim_t parent = guii_widget_getparentinnerwidth(h);
+        gui_dim_t rel_x = guii_widget_getrelativex(h);
+        if (parent > rel_x) {
+            return parent - rel_x;                  /* Return widget width */
+        }
+    } else if (guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) {   /* Percentage width */
+        return GUI_ROUND((h->width * guii_widget_getparentinnerwidth(h)) / 100.0f);
+    } else {                                        /* Normal width */
+        return h->width;                            /* Width in pixels */
+    }
+    return 0;
+}
+
+/**
+ * \brief           Calculate height of widget according to current setup (expanded, fill, percent, etc.)
+ * \param[in]       h: Widget handle
+ * \return          Total height in units of pixels
+ */
+static gui_dim_t
+calculate_widget_height(gui_handle_p h) {
+    if (guii_widget_getflag(h, GUI_FLAG_EXPANDED)) {   /* Maximize window over parent */
+        return guii_widget_getparentinnerheight(h);/* Return parent inner height */
+    } else if (guii_widget_getflag(h, GUI_FLAG_HEIGHT_FILL)) { /* "fill_parent" mode for height */
+        gui_dim_t parent = guii_widget_getparentinnerheight(h);
+        gui_dim_t rel_y = guii_widget_getrelativey(h);
+        if (parent > rel_y) {
+            return parent - rel_y;                  /* Return widget height */
+        }
+    } else if (guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT)) {  /* Percentage height */
+        return GUI_ROUND((h->height * guii_widget_getparentinnerheight(h)) / 100.0f);
+    } else {                                        /* Normal height */
+        return h->height;                           /* height in pixels */
+    }
+    return 0;
+}
+
+/**
+ * \brief           Calculate absolute position, size and visible area of widget and save it to cache
+ * \note            Parent widget geometry is calculated first if not valid
+ * \param[in]       h: Widget handle
+ */
+static void
+update_widget_geometry(gui_handle_p h) {
+    gui_handle_p p;
+    gui_handle_geometry_t* g = &h->geom;
+    gui_dim_t x, y, wi, hi;
+    
+    p = guii_widget_getparent(h);
+    if (p != NULL && !p->geom.valid) {              /* Make sure parent is up to date first */
+        update_widget_geometry(p);
+    }
+    
+    g->width = calculate_widget_width(h);           /* Get width in pixels */
+    g->height = calculate_widget_height(h);         /* Get height in pixels */
+    
+    /*
+     * Absolute position is relative position with parent absolute position, 
+     * parent padding and parent scroll
+     */
+    g->x = guii_widget_getrelativex(h);
+    g->y = guii_widget_getrelativey(h);
+    if (p != NULL) {
+        g->x += p->geom.x + guii_widget_getpaddingleft(p) - __GHR(p)->x_scroll;
+        g->y += p->geom.y + guii_widget_getpaddingtop(p) - __GHR(p)->y_scroll;
+    }
+    
+    /*
+     * Visible part is limited by parent inner area and visible part of parent
+     */
+    g->visible.x1 = g->x;
+    g->visible.y1 = g->y;
+    g->visible.x2 = g->x + g->width;
+    g->visible.y2 = g->y + g->height;
+    if (p != NULL) {
+        x = p->geom.x + guii_widget_getpaddingleft(p);  /* Parent absolute X position for inner widgets */
+        y = p->geom.y + guii_widget_getpaddingtop(p);   /* Parent absolute Y position for inner widgets */
+        wi = guii_widget_getinnerwidth(p);          /* Get parent inner width */
+        hi = guii_widget_getinnerheight(p);         /* Get parent inner height */
+        
+        if (g->visible.x1 < p->geom.visible.x1) { g->visible.x1 = p->geom.visible.x1; }
+        if (g->visible.y1 < p->geom.visible.y1) { g->visible.y1 = p->geom.visible.y1; }
+        if (g->visible.x2 > p->geom.visible.x2) { g->visible.x2 = p->geom.visible.x2; }
+        if (g->visible.y2 > p->geom.visible.y2) { g->visible.y2 = p->geom.visible.y2; }
+    } else {
+        x = 0;
+        y = 0;
+        wi = GUI.lcd.width;
+        hi = GUI.lcd.height;
+    }
+    if (g->visible.x1 < x)          { g->visible.x1 = x; }
+    if (g->visible.x2 > x + wi)     { g->visible.x2 = x + wi; }
+    if (g->visible.y1 < y)          { g->visible.y1 = y; }
+    if (g->visible.y2 > y + hi)     { g->visible.y2 = y + hi; }
+    
+    g->valid = 1;                                   /* Cache is valid now */
+}
+
 /**
  * \brief           Get vidget visible X, Y and width, height values on screen
  * 
@@ -193,37 +306,18 @@ remove_widgets(gui_handle_p parent) {
  */
 static uint8_t
 get_widget_abs_position_and_visible_width_height(gui_handle_p h, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
-    gui_dim_t x, y, wi, hi;
-    
-    __GUI_ASSERTPARAMS(guii_widget_iswidget(h));    /* Check valid parameter */
-    
-    x = guii_widget_getabsolutex(h);                /* Get absolute X position */
-    y = guii_widget_getabsolutey(h);                /* Get absolute Y position */
-    wi = guii_widget_getwidth(h);                   /* Get absolute width */
-    hi = guii_widget_getheight(h);                  /* Get absolute height */
-    
-    /*
-     * Set widget visible positions with X and Y coordinates
-     */
-    *x1 = x;
-    *y1 = y;
-    *x2 = x + wi;
-    *y2 = y + hi;
-    
-    /*
-     * Check if widget is hidden by any parent or any parent is hidden by its parent
-     */
-    for (; h != NULL; h = guii_widget_getparent(h)) {
-        x = guii_widget_getparentabsolutex(h);      /* Parent absolute X position for inner widgets */
-        y = guii_widget_getparentabsolutey(h);      /* Parent absolute Y position for inner widgets */
-        wi = guii_widget_getparentinnerwidth(h);    /* Get parent inner width */
-        hi = guii_widget_getparentinnerheight(h);   /* Get parent inner height */
+    if (!guii_widget_iswidget(h)) {                 /* Check valid parameter */
+        *x1 = *y1 = *x2 = *y2 = 0;                  /* Invalid widget has empty visible area */
+        return 0;
+    }
     
-        if (*x1 < x)        { *x1 = x; }
-        if (*x2 > x + wi)   { *x2 = x + wi; }
-        if (*y1 < y)        { *y1 = y; }
-        if (*y2 > y + hi)   { *y2 = y + hi; }
+    if (!h->geom.valid) {                           /* Calculate geometry if not valid */
+        update_widget_geometry(h);
     }
+    *x1 = h->geom.visible.x1;
+    *y1 = h->geom.visible.y1;
+    *x2 = h->geom.visible.x2;
+    *y2 = h->geom.visible.y2;
     
     return 1;
 }
@@ -251,11 +345,8 @@ set_clipping_region(gui_handle_p h) {
      * This may only work if padding is 0 and widget position wasn't changed
      */
     
-    /* Set invalid clipping region */
-    if (GUI.Display.x1 > x1)    { GUI.Display.x1 = x1; }
-    if (GUI.Display.x2 < x2)    { GUI.Display.x2 = x2; }
-    if (GUI.Display.y1 > y1)    { GUI.Display.y1 = y1; }
-    if (GUI.Display.y2 < y2)    { GUI.Display.y2 = y2; }
+    /* Add region to list of invalid regions */
+    guii_lcd_region_add(&GUI.DisplayInvalid, x1, y1, x2, y2);
     
     return 1;
 }
@@ -272,6 +363,8 @@ invalidate_widget(gui_handle_p h, uint8_t setclipping) {
     gui_handle_p h1, h2;
     gui_dim_t h1x1, h1x2, h2x1, h2x2;
     gui_dim_t h1y1, h1y2, h2y1, h2y2;
+    gui_display_list_t redraw;
+    size_t i;
     
     __GUI_ASSERTPARAMS(guii_widget_iswidget(h));    /* Check valid parameter */
                                                     /* Get widget handle */
@@ -302,7 +395,9 @@ invalidate_widget(gui_handle_p h, uint8_t setclipping) {
      * 
      * If widget should be redrawn, then any widget above it should be redrawn too, otherwise z-index match will fail.
      *
-     * Widget may not need redraw operation if positions don't match
+     * Widget may not need redraw operation if positions don't match.
+     * Areas of all widgets to redraw on this level are collected to small list of regions,
+     * so each widget above is checked only once against this list instead of against every other widget.
      *
      * If widget is transparent, check all widgets, even those which are below current widget in list
      * Get first element of parent linked list for checking
@@ -312,21 +407,26 @@ invalidate_widget(gui_handle_p h, uint8_t setclipping) {
         invalidate_widget(guii_widget_getparent(h1), 0);    /* Invalidate parent widget */
     }
 #endif /* GUI_CFG_USE_TRANSPARENCY */
-    for (; h1 != NULL; h1 = gui_linkedlist_widgetgetnext(NULL, h1)) {
-        get_widget_abs_position_and_visible_width_height(h1, &h1x1, &h1y1, &h1x2, &h1y2); /* Get visible position on LCD for widget */
-        for (h2 = gui_linkedlist_widgetgetnext(NULL, h1); h2;
-                h2 = gui_linkedlist_widgetgetnext(NULL, h2)) {
-            get_widget_abs_position_and_visible_width_height(h2, &h2x1, &h2y1, &h2x2, &h2y2);
-            if (
-                guii_widget_getflag(h2, GUI_FLAG_REDRAW) ||    /* Flag is already set */
-                !__GUI_RECT_MATCH(                  /* Widgets are not one over another */
-                    h1x1, h1y1, h1x2, h1y2,
-                    h2x1, h2y1, h2x2, h2y2)
-            ) {
+    get_widget_abs_position_and_visible_width_height(h1, &h1x1, &h1y1, &h1x2, &h1y2); /* Get visible position on LCD for widget */
+    redraw.count = 0;
+    guii_lcd_region_add(&redraw, h1x1, h1y1, h1x2, h1y2);
+    for (h2 = gui_linkedlist_widgetgetnext(NULL, h1); h2 != NULL;
+            h2 = gui_linkedlist_widgetgetnext(NULL, h2)) {
+        get_widget_abs_position_and_visible_width_height(h2, &h2x1, &h2y1, &h2x2, &h2y2);
+        if (!guii_widget_getflag(h2, GUI_FLAG_REDRAW)) {/* Check only widgets not yet marked for redraw */
+            for (i = 0; i < redraw.count; i++) {
+                if (__GUI_RECT_MATCH(               /* Widget is over area being redrawn */
+                    redraw.regions[i].x1, redraw.regions[i].y1, redraw.regions[i].x2, redraw.regions[i].y2,
+                    h2x1, h2y1, h2x2, h2y2)) {
+                    break;
+                }
+            }
+            if (i == redraw.count) {                /* Widgets are not one over another */
                 continue;
             }
             guii_widget_setflag(h2, GUI_FLAG_REDRAW);  /* Redraw widget on next loop */
         }
+        guii_lcd_region_add(&redraw, h2x1, h2y1, h2x2, h2y2);   /* Area of this widget is redrawn too */
     }
     
     /*
@@ -427,6 +527,7 @@ set_widget_size(gui_handle_p h, float wi, float hi) {
         }
         h->width = wi;                              /* Set parameter */
         h->height = hi;                             /* Set parameter */
+        guii_widget_resetgeometry(h);               /* Geometry of widget and children changed */
         if (invalidateSecond) {                     /* Invalidate second time only if widget greater than before */
             guii_widget_invalidatewithparent(h);    /* Set new clipping region */
         }
@@ -451,6 +552,7 @@ set_widget_position(gui_handle_p h, float x, float y) {
         }
         h->x = x;                                   /* Set parameter */
         h->y = y;                                   /* Set parameter */
+        guii_widget_resetgeometry(h);               /* Geometry of widget and children changed */
         if (!guii_widget_isexpanded(h)) {
             guii_widget_invalidatewithparent(h);    /* Set new clipping region */
         }
@@ -503,21 +605,134 @@ can_remove_widget(gui_handle_p h) {
 /**
  * \brief           Check if visible part of widget is inside clipping region for redraw
  * \param[in]       h: Widget handle
+ * \param[in]       disp: Clipping region to check widget against
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
-guii_widget_isinsideclippingregion(gui_handle_p h) {
+guii_widget_isinsideclippingregion(gui_handle_p h, const gui_display_t* disp) {
     gui_dim_t x1, y1, x2, y2;
-    __GUI_ASSERTPARAMS(guii_widget_iswidget(h));    /* Check valid parameter */
+    __GUI_ASSERTPARAMS(guii_widget_iswidget(h) && disp != NULL);    /* Check valid parameter */
     
     /* Get widget visible section */
     get_widget_abs_position_and_visible_width_height(h, &x1, &y1, &x2, &y2);
     return __GUI_RECT_MATCH(
         x1, y1, x2, y2,
-        GUI.Display.x1, GUI.Display.y1, GUI.Display.x2, GUI.Display.y2
+        disp->x1, disp->y1, disp->x2, disp->y2
     );
 }
 
+/**
+ * \brief           Maximal number of opaque widgets used together to check coverage of widgets below them
+ *
+ *                  When more opaque widgets are above, the biggest ones are used
+ */
+#define WIDGET_OCCLUDERS_MAX        4
+
+/**
+ * \brief           Check if rectangle is fully covered by union of rectangles
+ *
+ *                  Parts of rectangle outside first intersecting rectangle
+ *                  are checked against remaining rectangles
+ *
+ * \param[in]       r: Rectangle to check
+ * \param[in]       list: List of covering rectangles
+ * \param[in]       count: Number of rectangles in list
+ * \return          `1` if rectangle is covered, `0` otherwise
+ */
+static uint8_t
+rect_iscovered(const gui_display_t* r, const gui_display_t* list, size_t count) {
+    gui_display_t part;
+    
+    if (r->x1 >= r->x2 || r->y1 >= r->y2) {         /* Empty rectangle is always covered */
+        return 1;
+    }
+    for (; count > 0; count--, list++) {
+        if (list->x1 >= r->x2 || list->x2 <= r->x1 || list->y1 >= r->y2 || list->y2 <= r->y1) {
+            continue;                               /* No intersection */
+        }
+        
+        /* Check parts above, below, left and right of covering rectangle */
+        part = *r;
+        part.y2 = list->y1;
+        if (!rect_iscovered(&part, list + 1, count - 1)) {
+            return 0;
+        }
+        part.y1 = list->y2;
+        part.y2 = r->y2;
+        if (!rect_iscovered(&part, list + 1, count - 1)) {
+            return 0;
+        }
+        part.y1 = GUI_MAX(r->y1, list->y1);
+        part.y2 = GUI_MIN(r->y2, list->y2);
+        part.x2 = list->x1;
+        if (!rect_iscovered(&part, list + 1, count - 1)) {
+            return 0;
+        }
+        part.x1 = list->x2;
+        part.x2 = r->x2;
+        return rect_iscovered(&part, list + 1, count - 1);
+    }
+    return 0;
+}
+
+/**
+ * \brief           Set \ref GUI_FLAG_COVERED flag on children widgets whose visible part
+ *                  inside clipping region is fully covered by opaque widgets with higher z-index
+ *
+ *                  Widgets are checked from top to bottom in single pass. Union of areas of up to
+ *                  \ref WIDGET_OCCLUDERS_MAX biggest opaque widgets above is used for coverage check.
+ *
+ * \param[in]       parent: Parent widget handle or `NULL` for top level widgets
+ * \param[in]       disp: Clipping region to check widgets against
+ */
+void
+guii_widget_updatecovered(gui_handle_p parent, const gui_display_t* disp) {
+    gui_handle_p h;
+    gui_display_t r, occluders[WIDGET_OCCLUDERS_MAX];
+    size_t count = 0, i, min;
+    
+    for (h = gui_linkedlist_widgetgetprev((gui_handle_root_t *)parent, NULL); h != NULL;
+            h = gui_linkedlist_widgetgetprev(NULL, h)) {
+        guii_widget_clrflag(h, GUI_FLAG_COVERED);
+        if (!guii_widget_isvisible(h)) {
+            continue;
+        }
+        
+        /* Get widget visible section, limited to clipping region */
+        get_widget_abs_position_and_visible_width_height(h, &r.x1, &r.y1, &r.x2, &r.y2);
+        r.x1 = GUI_MAX(r.x1, disp->x1);
+        r.y1 = GUI_MAX(r.y1, disp->y1);
+        r.x2 = GUI_MIN(r.x2, disp->x2);
+        r.y2 = GUI_MIN(r.y2, disp->y2);
+        if (r.x1 >= r.x2 || r.y1 >= r.y2) {         /* Widget is outside clipping region */
+            continue;
+        }
+        if (count && rect_iscovered(&r, occluders, count)) {
+            guii_widget_setflag(h, GUI_FLAG_COVERED);
+            continue;                               /* Covered widget does not cover anything new */
+        }
+        if (!guii_widget_isopaque(h)) {
+            continue;
+        }
+        
+        /* Add widget to list of covering areas, replace smallest one when list is full */
+        if (count < WIDGET_OCCLUDERS_MAX) {
+            occluders[count++] = r;
+        } else {
+            for (min = 0, i = 1; i < count; i++) {
+                if ((int32_t)(occluders[i].x2 - occluders[i].x1) * (occluders[i].y2 - occluders[i].y1)
+                    < (int32_t)(occluders[min].x2 - occluders[min].x1) * (occluders[min].y2 - occluders[min].y1)) {
+                    min = i;
+                }
+            }
+            if ((int32_t)(r.x2 - r.x1) * (r.y2 - r.y1)
+                > (int32_t)(occluders[min].x2 - occluders[min].x1) * (occluders[min].y2 - occluders[min].y1)) {
+                occluders[min] = r;
+            }
+        }
+    }
+}
+
 /**
  * \brief           Init widget part of library
  */
@@ -686,20 +901,10 @@ guii_widget_getwidth(gui_handle_p h) {
         return 0;                                   \
     }
     
-    if (guii_widget_getflag(h, GUI_FLAG_EXPANDED)) {   /* Maximize window over parent */
-        return guii_widget_getparentinnerwidth(h); /* Return parent inner width */
-    } else if (guii_widget_getflag(h, GUI_FLAG_WIDTH_FILL)) {  /* "fill_parent" mode for width */
-        gui_dim_t parent = guii_widget_getparentinnerwidth(h);
-        gui_dim_t rel_x = guii_widget_getrelativex(h);
-        if (parent > rel_x) {
-            return parent - rel_x;                  /* Return widget width */
-        }
-    } else if (guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) {   /* Percentage width */
-        return GUI_ROUND((h->width * guii_widget_getparentinnerwidth(h)) / 100.0f);
-    } else {                                        /* Normal width */
-        return h->width;                            /* Width in pixels */
+    if (!h->geom.valid) {                           /* Calculate geometry if not valid */
+        update_widget_geometry(h);
     }
-    return 0;
+    return h->geom.width;
 }
 
 /**
@@ -720,20 +925,10 @@ guii_widget_getheight(gui_handle_p h) {
         return 0;                                   \
     }
     
-    if (guii_widget_getflag(h, GUI_FLAG_EXPANDED)) {   /* Maximize window over parent */
-        return guii_widget_getparentinnerheight(h);/* Return parent inner height */
-    } else if (guii_widget_getflag(h, GUI_FLAG_HEIGHT_FILL)) { /* "fill_parent" mode for height */
-        gui_dim_t parent = guii_widget_getparentinnerheight(h);
-        gui_dim_t rel_y = guii_widget_getrelativey(h);
-        if (parent > rel_y) {
-            return parent - rel_y;                  /* Return widget height */
-        }
-    } else if (guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT)) {  /* Percentage height */
-        return GUI_ROUND((h->height * guii_widget_getparentinnerheight(h)) / 100.0f);
-    } else {                                        /* Normal height */
-        return h->height;                           /* height in pixels */
+    if (!h->geom.valid) {                           /* Calculate geometry if not valid */
+        update_widget_geometry(h);
     }
-    return 0;
+    return h->geom.height;
 }
 
 /**
@@ -745,23 +940,14 @@ guii_widget_getheight(gui_handle_p h) {
  */
 gui_dim_t
 guii_widget_getabsolutex(gui_handle_p h) {
-    gui_handle_p w;
-    gui_dim_t out = 0;
-    
     if (h == NULL) {                                /* Check input value */
         return 0;                                   /* At left value */
     }
     
-    /* If widget is not expanded, use actual value */
-    out = guii_widget_getrelativex(h);              /* Get start relative position */
-    
-    /* Process all parent widgets to get real absolute screen value */
-    for (w = guii_widget_getparent(h); w != NULL;
-        w = guii_widget_getparent(w)) {             /* Go through all parent windows */
-        out += guii_widget_getrelativex(w) + guii_widget_getpaddingleft(w);   /* Add X offset from parent and left padding of parent */
-        out -= __GHR(w)->x_scroll;                  /* Decrease by scroll value */
+    if (!h->geom.valid) {                           /* Calculate geometry if not valid */
+        update_widget_geometry(h);
     }
-    return out;
+    return h->geom.x;
 }
 
 /**
@@ -773,23 +959,14 @@ guii_widget_getabsolutex(gui_handle_p h) {
  */
 gui_dim_t
 guii_widget_getabsolutey(gui_handle_p h) {
-    gui_handle_p w;
-    gui_dim_t out = 0;
-    
     if (h == NULL) {                                /* Check input value */
         return 0;                                   /* At top value */
     }
     
-    /* If widget is not expanded, use actual value */
-    out = guii_widget_getrelativey(h);              /* Get start relative position */
-    
-    /* Process all parent widgets to get real absolute screen value */
-    for (w = guii_widget_getparent(h); w != NULL;
-        w = guii_widget_getparent(w)) {             /* Go through all parent windows */
-        out += guii_widget_getrelativey(w) + guii_widget_getpaddingtop(w);    /* Add X offset from parent and left padding of parent */
-        out -= __GHR(w)->y_scroll;                  /* Decrease by scroll value */
+    if (!h->geom.valid) {                           /* Calculate geometry if not valid */
+        update_widget_geometry(h);
     }
-    return out;
+    return h->geom.y;
 }
 
 /**
@@ -928,6 +1105,34 @@ guii_widget_set3dstyle(gui_handle_p h, uint8_t enable) {
     return 1;
 }
 
+/**
+ * \brief           Reset cached geometry of widget and all its children widgets
+ * \note            Must be called on every change which affects widget position or size,
+ *                  such as position, size, padding, scroll or expanded mode
+ *
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in,out]   h: Widget handle
+ */
+void
+guii_widget_resetgeometry(gui_handle_p h) {
+    gui_handle_p tmp;
+    
+    /*
+     * Children may only have valid geometry if parent has valid geometry,
+     * nothing to do when cache of widget is already reset
+     */
+    if (!guii_widget_iswidget(h) || !h->geom.valid) {
+        return;
+    }
+    h->geom.valid = 0;
+    if (guii_widget_allowchildren(h)) {
+        for (tmp = gui_linkedlist_widgetgetnext(__GHR(h), NULL); tmp != NULL;
+                tmp = gui_linkedlist_widgetgetnext(NULL, tmp)) {
+            guii_widget_resetgeometry(tmp);
+        }
+    }
+}
+
 /*******************************************/
 /**  Widget create and remove management  **/
 /*******************************************/
@@ -1082,6 +1287,7 @@ guii_widget_setfont(gui_handle_p h, const gui_font_t* font) {
     __GUI_ASSERTPARAMS(guii_widget_iswidget(h));    /* Check valid parameter */
     if (h->font != font) {                          /* Any parameter changed */
         h->font = font;                             /* Set parameter */
+        guii_widget_resettextlayout(h);             /* Text must be measured again */
         guii_widget_invalidatewithparent(h);        /* Invalidate object */
     }
     return 1;
@@ -1102,6 +1308,7 @@ guii_widget_setfont(gui_handle_p h, const gui_font_t* font) {
 uint8_t
 guii_widget_settext(gui_handle_p h, const gui_char* text) {
     __GUI_ASSERTPARAMS(guii_widget_iswidget(h));    /* Check valid parameter */
+    guii_widget_resettextlayout(h);                 /* Text must be measured again */
     if (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {   /* Memory for text is dynamically allocated */
         if (h->textmemsize) {
             if (gui_string_lengthtotal(text) > (h->textmemsize - 1)) {  /* Check string length */
@@ -1145,9 +1352,10 @@ guii_widget_alloctextmemory(gui_handle_p h, uint32_t size) {
         h->textmemsize = 0;                         /* Reset memory size */
     }
     h->text = NULL;                                 /* Reset pointer */
+    guii_widget_resettextlayout(h);                 /* Text must be measured again */
     
     h->textmemsize = sizeof(gui_char) * size;       /* Allocate text memory */
-    h->text = GUI_MEMALLOC(__GH(h)->textmemsize);   /* Allocate memory for text */
+    h->text = GUI_MEMALLOC_CLASS(__GH(h)->textmemsize, GUI_MEM_CLASS_BULK); /* Allocate memory for text */
     if (h->text != NULL) {                          /* Check if allocated */
         guii_widget_setflag(h, GUI_FLAG_DYNAMICTEXTALLOC); /* Dynamically allocated */
     } else {
@@ -1174,6 +1382,7 @@ guii_widget_freetextmemory(gui_handle_p h) {
         GUI_MEMFREE(h->text);                       /* Free memory first */
         h->text = NULL;                             /* Reset memory */
         h->textmemsize = 0;                         /* Reset memory size */
+        guii_widget_resettextlayout(h);             /* Text must be measured again */
         guii_widget_clrflag(h, GUI_FLAG_DYNAMICTEXTALLOC); /* Not allocated */
         guii_widget_invalidate(h);                  /* Redraw object */
         guii_widget_callback(h, GUI_WC_TextChanged, NULL, NULL);   /* Process callback */
@@ -1230,6 +1439,7 @@ guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* kb) {
                 h->text[h->textcursor++] = kb->kb.keys[pos];
             }
             h->text[tlen + l] = 0;                  /* Add 0 to the end */
+            guii_widget_resettextlayout(h);         /* Text must be measured again */
             
             guii_widget_invalidate(h);              /* Invalidate widget */
             guii_widget_callback(h, GUI_WC_TextChanged, NULL, NULL);   /* Process callback */
@@ -1249,6 +1459,7 @@ guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* kb) {
             }
             h->textcursor -= l;                     /* Decrease text cursor by number of bytes for character deleted */
             h->text[tlen - l] = 0;                  /* Set 0 to the end of string */
+            guii_widget_resettextlayout(h);         /* Text must be measured again */
             
             guii_widget_invalidate(h);              /* Invalidate widget */
             guii_widget_callback(h, GUI_WC_TextChanged, NULL, NULL);/* Process callback */
@@ -1430,8 +1641,10 @@ guii_widget_setexpanded(gui_handle_p h, uint8_t state) {
     if (!state && guii_widget_isexpanded(h)) {     /* Check current status */
         guii_widget_invalidatewithparent(h);       /* Invalidate with parent first for clipping region */
         guii_widget_clrflag(h, GUI_FLAG_EXPANDED); /* Clear expanded after invalidation */
+        guii_widget_resetgeometry(h);              /* Geometry of widget and children changed */
     } else if (state && !guii_widget_isexpanded(h)) {
         guii_widget_setflag(h, GUI_FLAG_EXPANDED); /* Expand widget */
+        guii_widget_resetgeometry(h);              /* Geometry of widget and children changed */
         guii_widget_invalidate(h);                 /* Redraw only selected widget as it is over all window */
     }
     return 1;
@@ -1884,6 +2097,8 @@ gui_widget_freetextmemory(gui_handle_p h) {
  * \note            If dynamic memory allocation was used then content will be copied to allocated memory
  *                     otherwise only pointer to input text will be used 
  *                     and each further change of input pointer text will affect to output
+ * \note            Text layout is cached by text pointer. When static text is modified in place,
+ *                     call \ref gui_widget_invalidate (or this function with the same pointer) to measure it again
  * \param[in,out]   h: Widget handle
  * \param[in]       text: Pointer to text to set to widget
  * \return          `1` on success, `0` otherwise
@@ -2313,6 +2528,7 @@ gui_widget_setypositionpercent(gui_handle_p h, float y) {
 
 /**
  * \brief           Invalidate widget object and prepare to new redraw
+ * \note            Cached text layout is invalidated too, so text modified in place is measured again
  * \param[in,out]   h: Widget handle
  * \return          `1` on success, `0` otherwise
  */
@@ -2322,6 +2538,7 @@ gui_widget_invalidate(gui_handle_p h) {
     __GUI_ASSERTPARAMS(guii_widget_iswidget(h));    /* Check valid parameter */ 
     __GUI_ENTER();                                  /* Enter GUI */
     
+    guii_widget_resettextlayout(h);                 /* Text may be changed in place */
     res = guii_widget_invalidate(h);               /* Invalidate widget */
     
     __GUI_LEAVE();                                  /* Leave GUI */
@@ -2565,6 +2782,7 @@ gui_widget_setscrollx(gui_handle_p h, gui_dim_t scroll) {
     
     if (__GHR(h)->x_scroll != scroll) {             /* Only widgets with children support can set scroll */
         __GHR(h)->x_scroll = scroll;
+        guii_widget_resetgeometry(h);               /* Position of children widgets changed */
         guii_widget_invalidate(h);
         ret = 1;
     }
@@ -2590,6 +2808,7 @@ gui_widget_setscrolly(gui_handle_p h, gui_dim_t scroll) {
     
     if (__GHR(h)->y_scroll != scroll) {             /* Only widgets with children support can set scroll */
         __GHR(h)->y_scroll = scroll;
+        guii_widget_resetgeometry(h);               /* Position of children widgets changed */
         guii_widget_invalidate(h);
         ret = 1;
     }
@@ -2615,6 +2834,7 @@ gui_widget_incscrollx(gui_handle_p h, gui_dim_t scroll) {
     
     if (scroll) {                                   /* Only widgets with children support can set scroll */
         __GHR(h)->x_scroll += scroll;
+        guii_widget_resetgeometry(h);               /* Position of children widgets changed */
         guii_widget_invalidate(h);
         ret = 1;
     }
@@ -2640,6 +2860,7 @@ gui_widget_incscrolly(gui_handle_p h, gui_dim_t scroll) {
     
     if (scroll) {                                   /* Only widgets with children support can set scroll */
         __GHR(h)->y_scroll += scroll;
+        guii_widget_resetgeometry(h);               /* Position of children widgets changed */
         guii_widget_invalidate(h);
         ret = 1;
     }
@@ -55,7 +55,7 @@ static const
 gui_widget_t widget = {
     .name = _GT("WINDOW"),                          /*!< Widget name */
     .size = sizeof(gui_window_t),                   /*!< Size of widget for memory allocation */
-    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN,        /*!< List of widget flags */
+    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN | GUI_FLAG_WIDGET_OPAQUE,    /*!< List of widget flags */
     .callback = gui_window_callback,                /*!< Control function */
     .colors = colors,                               /*!< Pointer to colors array */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
@@ -162,6 +162,7 @@ gui_window_callback(gui_handle_p h, gui_wc_t ctrl, gui_widget_param_t* param, gu
                     f.align = GUI_HALIGN_CENTER | GUI_VALIGN_CENTER;
                     f.color1width = f.width;
                     f.color1 = guii_widget_getcolor(h, GUI_WINDOW_COLOR_TEXT);
+                    f.layout = guii_widget_gettextlayout(h);  /* Use cached text layout */
                     gui_draw_writetext(disp, guii_widget_getfont(h), guii_widget_gettext(h), &f);
                 }
             }